@@ -0,0 +1,7 @@
+shared uint counter;
+
+void foo() {
+    for (uint i = 0; i < atomicAdd(counter, 1); i++) {
+        process(i);
+    }
+}
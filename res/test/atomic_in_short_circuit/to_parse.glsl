@@ -0,0 +1,7 @@
+shared uint counter;
+
+void foo() {
+    if (bEnabled && atomicAdd(counter, 1) == 0) {
+        bFirst = true;
+    }
+}
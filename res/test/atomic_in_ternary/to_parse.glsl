@@ -0,0 +1,5 @@
+shared uint counter;
+
+void foo() {
+    uint v = bEnabled ? atomicAdd(counter, 1) : 0;
+}
@@ -0,0 +1,6 @@
+shared uint counters[2];
+
+void foo() {
+    uint slot = 0;
+    for (int i = 0; i < 4; i++) slot += atomicAdd(counters[1], 1) + 2;
+}
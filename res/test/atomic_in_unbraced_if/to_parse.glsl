@@ -0,0 +1,6 @@
+shared uint counters[2];
+
+void foo() {
+    uint slot = 0;
+    if (id > 5) slot = atomicAdd(counters[0], 1) + 1;
+}
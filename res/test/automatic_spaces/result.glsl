@@ -0,0 +1,11 @@
+layout(set = 1, binding = 0) uniform sampler2D hardcodedTexture;
+
+layout(set = 2, binding = 1) uniform ObjectData {
+    mat4 worldMatrix;
+} objectData;
+
+layout(set = 0, binding = 2) uniform FrameData {
+    mat4 viewProjectionMatrix;
+} frameData;
+
+layout(set = 0, binding = 3) uniform sampler2D shadowMap;
@@ -0,0 +1,11 @@
+Texture2D hardcodedTexture : register(t0, space1);
+
+struct ObjectData {
+    float4x4 worldMatrix;
+}; ConstantBuffer<ObjectData> objectData : register(b0, space2);
+
+struct FrameData {
+    float4x4 viewProjectionMatrix;
+}; ConstantBuffer<FrameData> frameData : register(b0, space0);
+
+Texture2D shadowMap : register(t0, space0);
@@ -0,0 +1,17 @@
+#glsl layout(set = 1, binding = 0) uniform sampler2D hardcodedTexture;
+#hlsl Texture2D hardcodedTexture : register(t0, space1);
+
+#glsl layout(set = ?object, binding = ?) uniform ObjectData {
+#hlsl struct ObjectData {
+    mat4 worldMatrix;
+#glsl } objectData;
+#hlsl }; ConstantBuffer<ObjectData> objectData : register(b?, space?object);
+
+#glsl layout(set = ?frame, binding = ?) uniform FrameData {
+#hlsl struct FrameData {
+    mat4 viewProjectionMatrix;
+#glsl } frameData;
+#hlsl }; ConstantBuffer<FrameData> frameData : register(b?, space?frame);
+
+#glsl layout(set = ?frame, binding = ?) uniform sampler2D shadowMap;
+#hlsl Texture2D shadowMap : register(t?, space?frame);
@@ -0,0 +1,5 @@
+layout(binding = 1) uniform sampler2D emissiveTexture;
+
+layout(binding = 0) uniform sampler2D diffuseTexture;
+
+layout(binding = 2) uniform sampler2D roughnessTexture;
@@ -0,0 +1,5 @@
+Texture2D emissiveTexture : register(t1);
+
+Texture2D diffuseTexture : register(t0);
+
+Texture2D roughnessTexture : register(t2);
@@ -0,0 +1,8 @@
+#glsl layout(binding = ?) uniform sampler2D diffuseTexture;
+#hlsl Texture2D diffuseTexture : register(t?);
+
+#glsl layout(binding = ?) uniform sampler2D normalTexture;
+#hlsl Texture2D normalTexture : register(t?);
+
+#glsl layout(binding = ?) uniform sampler2D roughnessTexture;
+#hlsl Texture2D roughnessTexture : register(t?);
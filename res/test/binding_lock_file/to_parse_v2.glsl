@@ -0,0 +1,8 @@
+#glsl layout(binding = ?) uniform sampler2D emissiveTexture;
+#hlsl Texture2D emissiveTexture : register(t?);
+
+#glsl layout(binding = ?) uniform sampler2D diffuseTexture;
+#hlsl Texture2D diffuseTexture : register(t?);
+
+#glsl layout(binding = ?) uniform sampler2D roughnessTexture;
+#hlsl Texture2D roughnessTexture : register(t?);
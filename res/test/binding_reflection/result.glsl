@@ -0,0 +1,7 @@
+layout(binding = 0) uniform FrameData {
+    mat4 viewProjectionMatrix;
+} frameData;
+
+layout(set = 1, binding = 2) uniform sampler2D diffuseTextures[];
+
+layout(binding = 1) uniform sampler2D normalTexture;
@@ -0,0 +1,7 @@
+struct FrameData {
+    float4x4 viewProjectionMatrix;
+}; ConstantBuffer<FrameData> frameData : register(b0);
+
+Texture2D diffuseTextures[] : register(t2, space1);
+
+Texture2D normalTexture : register(t0);
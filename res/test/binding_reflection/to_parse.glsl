@@ -0,0 +1,11 @@
+#glsl layout(binding = ?) uniform FrameData {
+#hlsl struct FrameData {
+    mat4 viewProjectionMatrix;
+#glsl } frameData;
+#hlsl }; ConstantBuffer<FrameData> frameData : register(b?);
+
+#glsl layout(set = 1, binding = 2) uniform sampler2D diffuseTextures[];
+#hlsl Texture2D diffuseTextures[] : register(t2, space1);
+
+#glsl layout(binding = ?) uniform sampler2D normalTexture;
+#hlsl Texture2D normalTexture : register(t?);
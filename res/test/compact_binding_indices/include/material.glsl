@@ -0,0 +1,5 @@
+#glsl layout(set = 0, binding = 1) uniform sampler2D shadowMap;
+#glsl layout(set = 1, binding = 1) uniform sampler2D materialTexture;
+#glsl layout(set = ?object, binding = 0) uniform ObjectData {
+    mat4 worldMatrix;
+#glsl } objectData;
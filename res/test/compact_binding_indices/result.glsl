@@ -0,0 +1,17 @@
+layout(set = 0, binding = 1) uniform sampler2D shadowMap;
+layout(set = 1, binding = 1) uniform sampler2D materialTexture;
+layout(set = 2, binding = 0) uniform ObjectData {
+    mat4 worldMatrix;
+} objectData;
+
+layout(set = 0, binding = 0) uniform FrameData {
+    mat4 viewProjectionMatrix;
+} frameData;
+layout(set = 1, binding = 0) uniform sampler2D diffuseTexture;
+layout(set = 2, binding = 1) uniform sampler2D objectTexture;
+layout(set = 1, binding = 2) uniform sampler2D normalTexture;
+layout(set = 2, binding = 2) uniform sampler2D objectMask;
+
+void foo(){
+    // some code here
+}
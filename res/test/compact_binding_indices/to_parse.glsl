@@ -0,0 +1,13 @@
+#include "include/material.glsl"
+
+#glsl layout(set = 0, binding = ?) uniform FrameData {
+    mat4 viewProjectionMatrix;
+#glsl } frameData;
+#glsl layout(set = 1, binding = ?) uniform sampler2D diffuseTexture;
+#glsl layout(set = ?object, binding = ?) uniform sampler2D objectTexture;
+#glsl layout(set = 1, binding = ?) uniform sampler2D normalTexture;
+#glsl layout(set = ?object, binding = ?) uniform sampler2D objectMask;
+
+void foo(){
+    // some code here
+}
@@ -0,0 +1,22 @@
+#glsl layout(push_constant) uniform Constants {
+#hlsl struct RootConstants {
+    uint materialIndex;
+    vec3 cameraPosition;
+#glsl } constants;
+#hlsl }; ConstantBuffer<RootConstants> constants : register(b0);
+
+#glsl layout(binding = ?) uniform FrameData {
+#hlsl struct FrameData {
+    mat4 viewProjectionMatrix;
+#glsl } frameData;
+#hlsl }; ConstantBuffer<FrameData> frameData : register(b?);
+
+#glsl layout(set = 1, binding = 0) uniform sampler2D diffuseTextures[];
+#hlsl Texture2D diffuseTextures[] : register(t0, space1);
+#hlsl SamplerState textureSampler : register(s0, space1);
+
+#glsl layout(binding = ?) readonly buffer Lights { vec4 lights[]; };
+#hlsl StructuredBuffer<float4> lights : register(t?);
+
+#glsl layout(binding = ?, rgba8) uniform writeonly image2D outputImages[4];
+#hlsl RWTexture2D<float4> outputImages[4] : register(u?);
@@ -0,0 +1,6 @@
+static const uint iSampleCount = 8;
+[[vk::constant_id(1)]] const bool bUseShadows = true; // toggled per quality preset
+void foo() {
+    for (uint i = 0; i < iSampleCount; i++) {
+    }
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+groupshared uint counter;
+groupshared uint visibleCount;
+groupshared int signedCounter;
+groupshared int maxValue;
+groupshared int minValue;
+
+int foo() {
+    InterlockedAdd(counter, 1);
+    uint index; InterlockedAdd(counter, 1, index);
+    InterlockedOr(flags[id], mask, previous);
+    uint cslAtomicOriginalValue0; InterlockedAdd(visibleCount, 1, cslAtomicOriginalValue0); visibleIds[cslAtomicOriginalValue0] = id;
+    int cslAtomicOriginalValue1; InterlockedAdd(signedCounter, 2, cslAtomicOriginalValue1); uint offset = baseOffset + cslAtomicOriginalValue1 * 4;
+    uint cslAtomicOriginalValue2; InterlockedCompareExchange(lock, 0, 1, cslAtomicOriginalValue2); if (cslAtomicOriginalValue2 == 0) {
+        uint cslAtomicOriginalValue3; InterlockedExchange(lock, 0, cslAtomicOriginalValue3);
+    }
+    uint cslAtomicOriginalValue4; InterlockedAdd(counter, 1, cslAtomicOriginalValue4); if (cslAtomicOriginalValue4 == 0 || bEnabled) {
+        return 0;
+    }
+    if (bReset) InterlockedAnd(flags[id], mask);
+    if (bCount)
+        InterlockedAdd(counter, 1, previous);
+    int cslAtomicOriginalValue5; InterlockedMax(maxValue, value, cslAtomicOriginalValue5); int cslAtomicOriginalValue6; InterlockedMin(minValue, value, cslAtomicOriginalValue6); return cslAtomicOriginalValue5 + cslAtomicOriginalValue6;
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+shared uint counter;
+shared uint visibleCount;
+shared int signedCounter;
+shared int maxValue;
+shared int minValue;
+
+int foo() {
+    atomicAdd(counter, 1);
+    uint index = atomicAdd(counter, 1);
+    previous = atomicOr(flags[id], mask);
+    visibleIds[atomicAdd(visibleCount, 1)] = id;
+    uint offset = baseOffset + atomicAdd(signedCounter, 2) * 4;
+    if (atomicCompSwap(lock, 0, 1) == 0) {
+        atomicExchange(lock, 0);
+    }
+    if (atomicAdd(counter, 1) == 0 || bEnabled) {
+        return 0;
+    }
+    if (bReset) atomicAnd(flags[id], mask);
+    if (bCount)
+        previous = atomicAdd(counter, 1);
+    return atomicMax(maxValue, value) + atomicMin(minValue, value);
+}
@@ -0,0 +1,5 @@
+shared uint visibleCount;
+
+void addVisible(uint id) {
+    visibleIds[atomicAdd(visibleCount, 1)] = id;
+}
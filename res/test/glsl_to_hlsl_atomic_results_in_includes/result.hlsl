@@ -0,0 +1,11 @@
+groupshared uint visibleCount;
+
+void addVisible(uint id) {
+    uint cslAtomicOriginalValue0; InterlockedAdd(visibleCount, 1, cslAtomicOriginalValue0); visibleIds[cslAtomicOriginalValue0] = id;
+}
+
+groupshared uint counter;
+
+void foo() {
+    uint cslAtomicOriginalValue1; InterlockedAdd(counter, 1, cslAtomicOriginalValue1); uint offset = cslAtomicOriginalValue1 * 4;
+}
\ No newline at end of file
@@ -0,0 +1,7 @@
+#include "include.glsl"
+
+shared uint counter;
+
+void foo() {
+    uint offset = atomicAdd(counter, 1) * 4;
+}
\ No newline at end of file
@@ -0,0 +1,12 @@
+void foo() {
+    GroupMemoryBarrierWithGroupSync();
+    DeviceMemoryBarrierWithGroupSync();
+    AllMemoryBarrierWithGroupSync();
+    AllMemoryBarrierWithGroupSync();
+    GroupMemoryBarrier();
+    DeviceMemoryBarrier();
+    DeviceMemoryBarrier();
+    AllMemoryBarrier();
+    AllMemoryBarrier();
+    GroupMemoryBarrierWithGroupSync();
+}
\ No newline at end of file
@@ -0,0 +1,12 @@
+void foo() {
+    memoryBarrierShared(); barrier();
+    memoryBarrierBuffer(); memoryBarrierImage(); barrier();
+    memoryBarrier(); barrier();
+    groupMemoryBarrier(); barrier();
+    memoryBarrierShared();
+    memoryBarrierBuffer(); memoryBarrierImage();
+    memoryBarrierImage();
+    memoryBarrier();
+    groupMemoryBarrier();
+    barrier();
+}
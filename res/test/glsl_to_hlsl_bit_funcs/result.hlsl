@@ -0,0 +1,24 @@
+uint packHalf2x16(float2 value) { return f32tof16(value.x) | (f32tof16(value.y) << 16); }
+float2 unpackHalf2x16(uint value) { return float2(f16tof32(value), f16tof32(value >> 16)); }
+uint packUnorm4x8(float4 value) {
+    uint4 bytes = uint4(round(saturate(value) * 255.0));
+    return bytes.x | (bytes.y << 8) | (bytes.z << 16) | (bytes.w << 24);
+}
+uint bitfieldExtract(uint value, int offset, int bits) {
+    return bits == 0 ? 0 : (value >> offset) & (0xFFFFFFFFu >> (32 - bits));
+}
+int bitfieldExtract(int value, int offset, int bits) {
+    return bits == 0 ? 0 : (value << (32 - bits - offset)) >> (32 - bits);
+}
+uint packNormal(float3 normal, float roughness) {
+    return packUnorm4x8(float4(normal * 0.5F + 0.5F, roughness));
+}
+
+void foo() {
+    uint packed = packHalf2x16(float2(1.0F, 0.5F));
+    float2 unpacked = unpackHalf2x16(packed);
+    uint count = countbits(mask);
+    int highest = firstbithigh(mask);
+    int lowest = firstbitlow(mask);
+    uint material = bitfieldExtract(packed, 8, 4);
+}
\ No newline at end of file
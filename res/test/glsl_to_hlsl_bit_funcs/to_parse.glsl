@@ -0,0 +1,12 @@
+uint packNormal(vec3 normal, float roughness) {
+    return packUnorm4x8(vec4(normal * 0.5F + 0.5F, roughness));
+}
+
+void foo() {
+    uint packed = packHalf2x16(vec2(1.0F, 0.5F));
+    vec2 unpacked = unpackHalf2x16(packed);
+    uint count = bitCount(mask);
+    int highest = findMSB(mask);
+    int lowest = findLSB(mask);
+    uint material = bitfieldExtract(packed, 8, 4);
+}
@@ -0,0 +1,13 @@
+void foo() {
+    [unroll] for (uint i = 0; i < 4; i++) {
+        [branch] if (values[i] > 0) {
+            values[i] = 0;
+        }
+    }
+    [loop]
+    for (uint i = 0; i < count; i++) {
+        [flatten] if (values[loop] > 0) {
+            values[i] = 1;
+        }
+    }
+}
\ No newline at end of file
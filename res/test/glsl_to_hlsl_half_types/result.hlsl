@@ -0,0 +1,7 @@
+
+void foo() {
+    half halfSize = half(0.5);
+    half3 color = half3(someColor);
+    half4x4 transform = half4x4(1.0);
+    float2 uv = float2(0.0F);
+}
\ No newline at end of file
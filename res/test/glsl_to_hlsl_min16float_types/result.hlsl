@@ -0,0 +1,7 @@
+
+void foo() {
+    min16float halfSize = min16float(0.5);
+    min16float3 color = min16float3(someColor);
+    min16float4x4 transform = min16float4x4(1.0);
+    float2 uv = float2(0.0F);
+}
\ No newline at end of file
@@ -0,0 +1,8 @@
+#glsl #version 450
+
+void foo() {
+    float16_t halfSize = float16_t(0.5);
+    f16vec3 color = f16vec3(someColor);
+    f16mat4 transform = f16mat4(1.0);
+    vec2 uv = vec2(0.0F);
+}
@@ -0,0 +1,7 @@
+void foo() {
+    float3x4 boneMatrix = boneMatrices[boneIndex];
+    float4x2 someMatrix;
+    float3x3 rotation;
+    half2x3 halfMatrix;
+    float3 skinnedPosition = mul(boneMatrix, float4(position, 1.0F));
+}
\ No newline at end of file
@@ -0,0 +1,14 @@
+
+void foo() {
+    float sum = WaveActiveSum(value);
+    float prefix = WavePrefixSum(value);
+    if (WaveIsFirstLane()) {
+        total = sum;
+    }
+    uint lane = WaveGetLaneIndex() + WaveGetLaneCount();
+    bool bAny = WaveActiveAnyTrue(value > 0.0F);
+    uint count = WaveActiveCountBits(value > 0.0F);
+    float first = WaveReadLaneFirst(value);
+    float other = WaveReadLaneAt(value, lane ^ 1);
+    float quad = QuadReadAcrossX(value);
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#glsl #version 450
+
+void foo() {
+    float sum = subgroupAdd(value);
+    float prefix = subgroupExclusiveAdd(value);
+    if (subgroupElect()) {
+        total = sum;
+    }
+    uint lane = gl_SubgroupInvocationID + gl_SubgroupSize;
+    bool bAny = subgroupAny(value > 0.0F);
+    uint count = subgroupBallotBitCount(subgroupBallot(value > 0.0F));
+    float first = subgroupBroadcastFirst(value);
+    float other = subgroupShuffle(value, lane ^ 1);
+    float quad = subgroupQuadSwapHorizontal(value);
+}
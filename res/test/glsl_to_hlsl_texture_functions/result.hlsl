@@ -0,0 +1,15 @@
+Texture2D colorTexture : register(t0);
+Texture3D volumeTextures[] : register(t1);
+SamplerState linearSampler : register(s0);
+void foo() {
+    float4 color = colorTexture.Load(int3(pixel, 0));
+    float4 voxel = volumeTextures[index].Load(int4(coords, lod));
+    float4 reds = colorTexture.GatherRed(linearSampler, uv);
+    float4 alphas = colorTexture.GatherAlpha(linearSampler, uv);
+    float4 filtered = colorTexture.Sample(linearSampler, uv) + volumeTextures[index].SampleLevel(linearSampler, uvw, 2.0F);
+    float4 biased = colorTexture.SampleBias(linearSampler, uv, 2.0F) + colorTexture.SampleBias(linearSampler, uv, 1.0F, offset);
+    float4 offsets = colorTexture.Sample(linearSampler, uv, offset) + colorTexture.SampleLevel(linearSampler, uv, 0.0F, offset);
+    float4 gradients = colorTexture.SampleGrad(linearSampler, uv, dx, dy) + colorTexture.SampleGrad(linearSampler, uv, dx, dy, offset);
+    // texture(colorTexture, uv) is not converted in comments
+    float4 unknown = texture(someOtherTexture, uv);
+}
\ No newline at end of file
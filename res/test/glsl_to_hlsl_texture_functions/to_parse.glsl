@@ -0,0 +1,17 @@
+#glsl layout(binding = 0) uniform sampler2D colorTexture;
+#hlsl Texture2D colorTexture : register(t0);
+#glsl layout(binding = 1) uniform sampler3D volumeTextures[];
+#hlsl Texture3D volumeTextures[] : register(t1);
+#hlsl SamplerState linearSampler : register(s0);
+void foo() {
+    vec4 color = texelFetch(colorTexture, pixel, 0);
+    vec4 voxel = texelFetch(volumeTextures[index], coords, lod);
+    vec4 reds = textureGather(colorTexture, uv);
+    vec4 alphas = textureGather(colorTexture, uv, 3);
+    vec4 filtered = texture(colorTexture, uv) + textureLod(volumeTextures[index], uvw, 2.0F);
+    vec4 biased = texture(colorTexture, uv, 2.0F) + textureOffset(colorTexture, uv, offset, 1.0F);
+    vec4 offsets = textureOffset(colorTexture, uv, offset) + textureLodOffset(colorTexture, uv, 0.0F, offset);
+    vec4 gradients = textureGrad(colorTexture, uv, dx, dy) + textureGradOffset(colorTexture, uv, dx, dy, offset);
+    // texture(colorTexture, uv) is not converted in comments
+    vec4 unknown = texture(someOtherTexture, uv);
+}
@@ -0,0 +1,4 @@
+[numthreads(8, 8, 1)]
+void main() {
+    GroupMemoryBarrierWithGroupSync();
+}
\ No newline at end of file
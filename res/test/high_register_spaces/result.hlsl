@@ -0,0 +1,11 @@
+Texture2D bindlessTextures[] : register(t0, space31);
+Texture2D someTexture : register(t1, space31);
+Texture2D otherTexture : register(t64, space100);
+Texture2D anotherTexture : register(t0, space100);
+RWTexture2D<float4> outputA : register(u0, space12);
+RWTexture2D<float4> outputB : register(u1, space12);
+SamplerState someSampler : register(s0);
+
+void foo(){
+    // some code here
+}
@@ -0,0 +1,11 @@
+#hlsl Texture2D bindlessTextures[] : register(t0, space31);
+#hlsl Texture2D someTexture : register(t?, space31);
+#hlsl Texture2D otherTexture : register(t64, space100);
+#hlsl Texture2D anotherTexture : register(t?, space100);
+#hlsl RWTexture2D<float4> outputA : register(u?, space12);
+#hlsl RWTexture2D<float4> outputB : register(u?, space12);
+#hlsl SamplerState someSampler : register(s?);
+
+void foo(){
+    // some code here
+}
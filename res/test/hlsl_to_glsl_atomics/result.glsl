@@ -0,0 +1,7 @@
+void foo() {
+    atomicAdd(counter, 1);
+    index = atomicAdd(counter, 1);
+    previous = atomicCompSwap(lock, 0, 1);
+    atomicCompSwap(lock, 1, 0);
+    oldValue = atomicExchange(values[id], max(value, 1));
+}
\ No newline at end of file
@@ -0,0 +1,7 @@
+void foo() {
+    InterlockedAdd(counter, 1);
+    InterlockedAdd(counter, 1, index);
+    InterlockedCompareExchange(lock, 0, 1, previous);
+    InterlockedCompareStore(lock, 1, 0);
+    InterlockedExchange(values[id], max(value, 1), oldValue);
+}
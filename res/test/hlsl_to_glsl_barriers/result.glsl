@@ -0,0 +1,8 @@
+void foo() {
+    memoryBarrierShared(); barrier();
+    memoryBarrierBuffer(); memoryBarrierImage(); barrier();
+    memoryBarrier(); barrier();
+    memoryBarrierShared();
+    memoryBarrierBuffer(); memoryBarrierImage();
+    memoryBarrier();
+}
\ No newline at end of file
@@ -0,0 +1,8 @@
+void foo() {
+    GroupMemoryBarrierWithGroupSync();
+    DeviceMemoryBarrierWithGroupSync();
+    AllMemoryBarrierWithGroupSync();
+    GroupMemoryBarrier();
+    DeviceMemoryBarrier();
+    AllMemoryBarrier();
+}
@@ -0,0 +1,10 @@
+#version 450
+uint f32tof16(float value) { return packHalf2x16(vec2(value, 0.0)); }
+float f16tof32(uint value) { return unpackHalf2x16(value).x; }
+void foo() {
+    uint packed = f32tof16(value) | (f32tof16(otherValue) << 16);
+    float unpacked = f16tof32(packed >> 16);
+    uint count = bitCount(mask);
+    int highest = int(findMSB(mask)) + int(findLSB(mask));
+    uint reversed = bitfieldReverse(mask);
+}
\ No newline at end of file
@@ -0,0 +1,8 @@
+#glsl #version 450
+void foo() {
+    uint packed = f32tof16(value) | (f32tof16(otherValue) << 16);
+    float unpacked = f16tof32(packed >> 16);
+    uint count = countbits(mask);
+    int highest = int(firstbithigh(mask)) + int(firstbitlow(mask));
+    uint reversed = reversebits(mask);
+}
@@ -0,0 +1,18 @@
+#version 450
+#extension GL_EXT_control_flow_attributes : require
+void foo() {
+    [[unroll]] for (uint i = 0; i < 4; i++) {
+        [[branch]] if (values[i] > 0) {
+            values[i] = 0;
+        }
+    }
+    [[unroll]]
+    for (uint i = 0; i < 8; i++) {
+        [[flatten]] if (values[branch] > 0) {
+            values[i] = 1;
+        }
+    }
+    [[dont_unroll]] while (values[0] > 0) {
+        values[0] -= 1;
+    }
+}
\ No newline at end of file
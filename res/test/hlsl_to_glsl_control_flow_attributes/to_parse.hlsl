@@ -0,0 +1,17 @@
+#glsl #version 450
+void foo() {
+    [unroll] for (uint i = 0; i < 4; i++) {
+        [branch] if (values[i] > 0) {
+            values[i] = 0;
+        }
+    }
+    [unroll(8)]
+    for (uint i = 0; i < 8; i++) {
+        [flatten] if (values[branch] > 0) {
+            values[i] = 1;
+        }
+    }
+    [loop] while (values[0] > 0) {
+        values[0] -= 1;
+    }
+}
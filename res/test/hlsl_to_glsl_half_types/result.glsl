@@ -0,0 +1,7 @@
+#extension GL_EXT_shader_explicit_arithmetic_types_float16 : require
+void foo() {
+    float16_t halfSize = float16_t(0.5);
+    f16vec3 color = f16vec3(someColor);
+    f16vec4 value = f16vec4(color, halfSize);
+    f16mat4 transform = f16mat4(someMatrix);
+}
\ No newline at end of file
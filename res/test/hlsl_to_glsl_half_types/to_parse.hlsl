@@ -0,0 +1,6 @@
+void foo() {
+    half halfSize = half(0.5);
+    half3 color = half3(someColor);
+    min16float4 value = min16float4(color, halfSize);
+    half4x4 transform = half4x4(someMatrix);
+}
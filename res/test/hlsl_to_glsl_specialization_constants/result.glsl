@@ -0,0 +1,6 @@
+layout(constant_id = 0) const uint iSampleCount = 4;
+layout(constant_id = 1) const bool bUseShadows = true; // toggled per quality preset
+void foo() {
+    for (uint i = 0; i < iSampleCount; i++) {
+    }
+}
\ No newline at end of file
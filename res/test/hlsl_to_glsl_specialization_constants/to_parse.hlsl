@@ -0,0 +1,6 @@
+[[vk::constant_id(0)]] const uint iSampleCount = 4;
+[[vk::constant_id(1)]] const bool bUseShadows = true; // toggled per quality preset
+void foo() {
+    for (uint i = 0; i < iSampleCount; i++) {
+    }
+}
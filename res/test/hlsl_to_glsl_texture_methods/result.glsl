@@ -0,0 +1,13 @@
+layout(binding = 0) uniform sampler2D colorTexture;
+layout(binding = 1) uniform usampler2DArray layers[];
+void foo() {
+    vec4 color = texelFetch(colorTexture, (ivec3(1, 2, 0)).xy, (ivec3(1, 2, 0)).z);
+    uvec4 layer = texelFetch(layers[indices[i]], location.xyz, location.w);
+    vec4 reds = textureGather(colorTexture, uv);
+    vec4 alphas = textureGather(colorTexture, uv, 3);
+    vec4 filtered = texture(colorTexture, uv) + textureLod(colorTexture, uv, 2.0F);
+    vec4 biased = texture(colorTexture, uv, 2.0F) + textureOffset(colorTexture, uv, offset, 1.0F);
+    vec4 offsets = textureOffset(colorTexture, uv, offset) + textureLodOffset(colorTexture, uv, 0.0F, offset);
+    vec4 gradients = textureGrad(colorTexture, uv, dx, dy) + textureGradOffset(colorTexture, uv, dx, dy, offset);
+    uint value = someBuffer.Load(offset);
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#glsl layout(binding = 0) uniform sampler2D colorTexture;
+#hlsl Texture2D colorTexture : register(t0);
+#glsl layout(binding = 1) uniform usampler2DArray layers[];
+#hlsl Texture2DArray<uint4> layers[] : register(t1);
+#hlsl SamplerState linearSampler : register(s0);
+void foo() {
+    vec4 color = colorTexture.Load(ivec3(1, 2, 0));
+    uvec4 layer = layers[indices[i]].Load(location);
+    vec4 reds = colorTexture.Gather(linearSampler, uv);
+    vec4 alphas = colorTexture.GatherAlpha(linearSampler, uv);
+    vec4 filtered = colorTexture.Sample(linearSampler, uv) + colorTexture.SampleLevel(linearSampler, uv, 2.0F);
+    vec4 biased = colorTexture.SampleBias(linearSampler, uv, 2.0F) + colorTexture.SampleBias(linearSampler, uv, 1.0F, offset);
+    vec4 offsets = colorTexture.Sample(linearSampler, uv, offset) + colorTexture.SampleLevel(linearSampler, uv, 0.0F, offset);
+    vec4 gradients = colorTexture.SampleGrad(linearSampler, uv, dx, dy) + colorTexture.SampleGrad(linearSampler, uv, dx, dy, offset);
+    uint value = someBuffer.Load(offset);
+}
@@ -0,0 +1,15 @@
+#extension GL_KHR_shader_subgroup_basic : require
+#extension GL_KHR_shader_subgroup_arithmetic : require
+#extension GL_KHR_shader_subgroup_ballot : require
+#extension GL_KHR_shader_subgroup_shuffle : require
+void foo() {
+    float sum = subgroupAdd(value);
+    float prefix = subgroupExclusiveAdd(value);
+    if (subgroupElect()) {
+        total = sum;
+    }
+    uint lane = gl_SubgroupInvocationID + gl_SubgroupSize;
+    uint count = subgroupBallotBitCount(subgroupBallot(value > 0.0F)) + subgroupBallotExclusiveBitCount(subgroupBallot(max(value, 1.0F) > 0.0F));
+    float other = subgroupShuffle(value, lane ^ 1);
+    float maxValue = subgroupMax(value);
+}
\ No newline at end of file
@@ -0,0 +1,11 @@
+void foo() {
+    float sum = WaveActiveSum(value);
+    float prefix = WavePrefixSum(value);
+    if (WaveIsFirstLane()) {
+        total = sum;
+    }
+    uint lane = WaveGetLaneIndex() + WaveGetLaneCount();
+    uint count = WaveActiveCountBits(value > 0.0F) + WavePrefixCountBits(max(value, 1.0F) > 0.0F);
+    float other = WaveReadLaneAt(value, lane ^ 1);
+    float maxValue = WaveActiveMax(value);
+}
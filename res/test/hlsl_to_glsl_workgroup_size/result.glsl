@@ -0,0 +1,4 @@
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+void main() {
+    memoryBarrierShared(); barrier();
+}
\ No newline at end of file
@@ -0,0 +1,5 @@
+groupshared int counters[2];
+
+uint takeSlot() {
+    int cslAtomicOriginalValue0; InterlockedAdd(counters[0], 1, cslAtomicOriginalValue0); return cslAtomicOriginalValue0 + 1;
+}
\ No newline at end of file
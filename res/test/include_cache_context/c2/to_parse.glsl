@@ -0,0 +1,3 @@
+shared int counters[2];
+
+#include "../shared/inc.glsl"
\ No newline at end of file
@@ -0,0 +1,3 @@
+uint takeSlot() {
+    return atomicAdd(counters[0], 1) + 1;
+}
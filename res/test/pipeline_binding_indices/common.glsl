@@ -0,0 +1,5 @@
+#glsl layout(binding = ?) uniform FrameData {
+#hlsl struct FrameData {
+    mat4 viewProjectionMatrix;
+#glsl } frameData;
+#hlsl }; ConstantBuffer<FrameData> frameData : register(b?);
@@ -0,0 +1,7 @@
+#include "common.glsl"
+
+#glsl layout(binding = 3) uniform sampler2D lightMap;
+#hlsl Texture2D lightMap : register(t3);
+
+#glsl layout(binding = ?) uniform sampler2D diffuseTexture;
+#hlsl Texture2D diffuseTexture : register(t?);
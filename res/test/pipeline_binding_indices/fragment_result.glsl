@@ -0,0 +1,7 @@
+layout(binding = 0) uniform FrameData {
+    mat4 viewProjectionMatrix;
+} frameData;
+
+layout(binding = 3) uniform sampler2D lightMap;
+
+layout(binding = 2) uniform sampler2D diffuseTexture;
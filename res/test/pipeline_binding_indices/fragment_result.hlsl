@@ -0,0 +1,7 @@
+struct FrameData {
+    float4x4 viewProjectionMatrix;
+}; ConstantBuffer<FrameData> frameData : register(b0);
+
+Texture2D lightMap : register(t3);
+
+Texture2D diffuseTexture : register(t1);
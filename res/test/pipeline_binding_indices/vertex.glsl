@@ -0,0 +1,4 @@
+#include "common.glsl"
+
+#glsl layout(binding = ?) uniform sampler2D heightMap;
+#hlsl Texture2D heightMap : register(t?);
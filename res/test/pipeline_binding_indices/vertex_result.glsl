@@ -0,0 +1,5 @@
+layout(binding = 0) uniform FrameData {
+    mat4 viewProjectionMatrix;
+} frameData;
+
+layout(binding = 1) uniform sampler2D heightMap;
@@ -0,0 +1,5 @@
+struct FrameData {
+    float4x4 viewProjectionMatrix;
+}; ConstantBuffer<FrameData> frameData : register(b0);
+
+Texture2D heightMap : register(t0);
@@ -0,0 +1,10 @@
+layout(location = ?) flat in uint fragmentMaterialIndex;
+layout(location = ?) in vec2 fragmentUv;
+layout(location = ?) in vec3 fragmentPosition;
+
+layout(location = ?) out vec4 outColor;
+layout(location = ?) out vec4 outNormal;
+
+void main(){
+    // some code here
+}
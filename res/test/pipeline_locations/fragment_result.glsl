@@ -0,0 +1,10 @@
+layout(location = 5) flat in uint fragmentMaterialIndex;
+layout(location = 1) in vec2 fragmentUv;
+layout(location = 0) in vec3 fragmentPosition;
+
+layout(location = 0) out vec4 outColor;
+layout(location = 1) out vec4 outNormal;
+
+void main(){
+    // some code here
+}
@@ -0,0 +1,13 @@
+layout(location = ?) in vec3 normal;
+layout(location = ?) in vec3 position;
+layout(location = ?) in mat4 instanceTransform;
+layout(location = ?) in vec2 uv;
+
+layout(location = 0) out vec3 fragmentPosition; // hardcoded
+layout(location = ?) out vec2 fragmentUv;
+layout(location = ?) out mat3 fragmentTbn;
+layout(location = ?) flat out uint fragmentMaterialIndex;
+
+void main(){
+    // some code here
+}
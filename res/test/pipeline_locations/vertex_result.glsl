@@ -0,0 +1,13 @@
+layout(location = 1) in vec3 normal;
+layout(location = 0) in vec3 position;
+layout(location = 3) in mat4 instanceTransform;
+layout(location = 2) in vec2 uv;
+
+layout(location = 0) out vec3 fragmentPosition; // hardcoded
+layout(location = 1) out vec2 fragmentUv;
+layout(location = 2) out mat3 fragmentTbn;
+layout(location = 5) flat out uint fragmentMaterialIndex;
+
+void main(){
+    // some code here
+}
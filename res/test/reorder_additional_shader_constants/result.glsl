@@ -0,0 +1,15 @@
+layout(push_constant) uniform Constants
+{
+    uint materialIndex;
+float exposure;
+vec2 jitter;
+mat4 viewMatrix;
+vec3 cameraPosition;
+vec3 sunDirection;
+} constants;
+
+
+
+void foo(){
+    // some code here
+}
\ No newline at end of file
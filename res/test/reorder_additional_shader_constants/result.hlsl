@@ -0,0 +1,15 @@
+
+struct RootConstants
+{
+    uint materialIndex;
+float3 cameraPosition;
+float4x4 viewMatrix;
+float3 sunDirection;
+float exposure;
+float2 jitter;
+}; ConstantBuffer<RootConstants> constants : register(b0);
+
+
+void foo(){
+    // some code here
+}
\ No newline at end of file
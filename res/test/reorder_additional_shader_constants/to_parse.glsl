@@ -0,0 +1,13 @@
+#include "include/constants.glsl"
+
+#additional_shader_constants vec3 cameraPosition;
+#additional_shader_constants vec2 jitter; // will be moved
+#additional_shader_constants{
+    mat4 viewMatrix;
+    float exposure;
+}
+#additional_shader_constants vec3 sunDirection;
+
+void foo(){
+    // some code here
+}
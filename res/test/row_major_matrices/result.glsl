@@ -0,0 +1,8 @@
+#extension GL_EXT_shader_explicit_arithmetic_types_float16 : require
+void foo() {
+    mat4x3 boneMatrix = boneMatrices[boneIndex];
+    mat2x4 someMatrix;
+    mat3x3 rotation;
+    f16mat3x2 halfMatrix;
+    vec3 skinnedPosition = (boneMatrix* vec4(position, 1.0F));
+}
\ No newline at end of file
@@ -0,0 +1,7 @@
+void foo() {
+    float4x3 boneMatrix = boneMatrices[boneIndex];
+    float2x4 someMatrix;
+    float3x3 rotation;
+    half3x2 halfMatrix;
+    float3 skinnedPosition = mul(float4(position, 1.0F), boneMatrix);
+}
\ No newline at end of file
@@ -0,0 +1,7 @@
+void foo() {
+    mat4x3 boneMatrix = boneMatrices[boneIndex];
+    mat2x4 someMatrix;
+    mat3x3 rotation;
+    f16mat3x2 halfMatrix;
+    vec3 skinnedPosition = mul(vec4(position, 1.0F), boneMatrix);
+}
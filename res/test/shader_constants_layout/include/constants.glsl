@@ -0,0 +1,13 @@
+#glsl{
+layout(push_constant) uniform Constants
+{
+    uint materialIndex;
+} constants;
+}
+
+#hlsl{
+struct RootConstants
+{
+    uint materialIndex;
+}; ConstantBuffer<RootConstants> constants : register(b0);
+}
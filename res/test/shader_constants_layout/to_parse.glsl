@@ -0,0 +1,10 @@
+#include "include/constants.glsl"
+
+#additional_shader_constants vec3 cameraPosition; // aligned differently in GLSL and HLSL
+#additional_shader_constants float exposure;
+#additional_shader_constants mat4 viewMatrix;
+#additional_shader_constants float weights[2];
+
+void foo(){
+    // some code here
+}
@@ -0,0 +1,22 @@
+#glsl{
+layout(push_constant) uniform Constants
+{
+    float16_t scale;
+} constants;
+}
+
+#hlsl{
+struct RootConstants
+{
+    half scale;
+}; ConstantBuffer<RootConstants> constants : register(b0);
+}
+
+#additional_shader_constants f16vec3 tint;
+#additional_shader_constants float16_t bias;
+#additional_shader_constants f16vec4 color;
+#additional_shader_constants f16mat2 transform;
+
+void foo(){
+    // some code here
+}
\ No newline at end of file
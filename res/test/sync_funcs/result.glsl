@@ -1,3 +1,3 @@
 void foo() {
-    groupMemoryBarrier(); barrier();
+    memoryBarrierShared(); barrier();
 }
\ No newline at end of file
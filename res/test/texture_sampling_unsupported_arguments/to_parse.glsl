@@ -0,0 +1,6 @@
+#glsl layout(binding = 0) uniform sampler2D colorTexture;
+#hlsl Texture2D colorTexture : register(t0);
+#hlsl SamplerState linearSampler : register(s0);
+void foo() {
+    vec4 clamped = colorTexture.Sample(linearSampler, uv, offset, minLod);
+}
@@ -0,0 +1,8 @@
+#glsl layout(binding = 0) uniform sampler2D colorTexture;
+#hlsl Texture2D colorTexture : register(t0);
+#hlsl SamplerState linearSampler : register(s0);
+#hlsl SamplerState pointSampler : register(s1);
+void foo() {
+    vec4 color = texelFetch(colorTexture, pixel, 0);
+    vec4 filtered = texture(colorTexture, uv);
+}
@@ -0,0 +1,8 @@
+layout(local_size_x = 64) in;
+
+layout(std430, binding = 0) buffer VisibleIds { uint vVisibleIds[]; };
+shared uint iVisibleCount;
+
+void main() {
+    memoryBarrierShared(); barrier();
+}
\ No newline at end of file
@@ -0,0 +1,8 @@
+
+RWStructuredBuffer<uint> vVisibleIds : register(u0);
+groupshared uint iVisibleCount;
+
+[numthreads(64, 1, 1)]
+void main() {
+    GroupMemoryBarrierWithGroupSync();
+}
\ No newline at end of file
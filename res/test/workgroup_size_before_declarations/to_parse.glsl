@@ -0,0 +1,9 @@
+layout(local_size_x = 64) in;
+
+#glsl layout(std430, binding = 0) buffer VisibleIds { uint vVisibleIds[]; };
+#hlsl RWStructuredBuffer<uint> vVisibleIds : register(u0);
+shared uint iVisibleCount;
+
+void main() {
+    memoryBarrierShared(); barrier();
+}
@@ -0,0 +1,4 @@
+layout(local_size_x = 16, local_size_y = 4, local_size_z = 1) in; // tuned per platform
+void main() {
+    memoryBarrierShared(); barrier();
+}
\ No newline at end of file
@@ -0,0 +1,5 @@
+// tuned per platform
+[numthreads(16, 4, 1)]
+void main() {
+    GroupMemoryBarrierWithGroupSync();
+}
\ No newline at end of file
@@ -0,0 +1,4 @@
+layout(local_size_x = ?, local_size_y = ?, local_size_z = 1) in; // tuned per platform
+void main() {
+    memoryBarrierShared(); barrier();
+}
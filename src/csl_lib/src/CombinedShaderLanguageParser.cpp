@@ -4,55 +4,217 @@
 #include <fstream>
 #include <format>
 #include <array>
-
-std::variant<std::string, CombinedShaderLanguageParser::Error> CombinedShaderLanguageParser::runParsing(
-    const std::filesystem::path& pathToShaderSourceFile,
-    bool bParseAsHlsl,
-    const std::vector<std::filesystem::path>& vAdditionalIncludeDirectories,
-    unsigned int iBaseAutomaticBindingIndex) {
+#include <algorithm>
+#include <bit>
+#include <tuple>
+#include <span>
+#include <cstring>
+#include <utility>
+#include <random>
+
+// Custom.
+#include "FileLock.h"
+
+std::variant<CombinedShaderLanguageParser::ParseResult, CombinedShaderLanguageParser::Error>
+CombinedShaderLanguageParser::runParsing(
+    const std::filesystem::path& pathToShaderSourceFile, bool bParseAsHlsl, const ParseOptions& options) {
     // Prepare some variables.
     BindingIndicesInfo bindingIndicesInfo{};
+    bindingIndicesInfo.bShareIndicesBetweenSameResources = !options.pathToBindingLockFile.empty();
+    bindingIndicesInfo.bTrackGlslIndicesPerSet = options.bCompactBindingIndices;
     std::vector<std::string> vFoundAdditionalPushConstants;
 
+    // Reserve the resulting code (included files are parsed into the same string), included files
+    // are scanned only if caches need their content hashes.
+    ParseResult parseResult{};
+    IncludeCacheContext includeCache{};
+    ScannedFileInfo scannedFileInfo{};
+    if (isCacheEnabled(options)) {
+        scannedFileInfo = scanSourceFile(
+            pathToShaderSourceFile, options.vAdditionalIncludeDirectories, includeCache.scannedFiles);
+    } else {
+        scannedFileInfo.iEstimatedParsedSize = estimateParsedSize(pathToShaderSourceFile);
+    }
+    parseResult.sFullSourceCode.reserve(scannedFileInfo.iEstimatedParsedSize);
+
+    // Open the include cache.
+    auto optionalCacheError = openIncludeCache(bParseAsHlsl, options, includeCache);
+    if (optionalCacheError.has_value()) [[unlikely]] {
+        return Error(optionalCacheError.value(), options.pathToIncludeCacheDirectory);
+    }
+
+    // Take parse results from the remote cache if found (errors of the cache are counted in its statistics).
+    std::string sRemoteCacheKey;
+    if (options.pRemoteParseCache != nullptr && options.pathToBindingLockFile.empty() &&
+        options.pathToDescriptorLayoutFile.empty()) {
+        sRemoteCacheKey =
+            makeParseResultCacheKey(options, includeCache.sOptionsKey, scannedFileInfo.iContentHash);
+        auto findResult = options.pRemoteParseCache->find(sRemoteCacheKey);
+        if (std::holds_alternative<std::optional<std::string>>(findResult)) {
+            const auto& optionalData = std::get<std::optional<std::string>>(findResult);
+            if (optionalData.has_value()) {
+                auto optionalCachedResult = deserializeParseResult(optionalData.value());
+                if (optionalCachedResult.has_value()) {
+                    return std::move(optionalCachedResult.value());
+                }
+            }
+        }
+    }
+
     // Parse.
-    auto result = parseFile(
+    auto optionalParseError = parseFile(
         pathToShaderSourceFile,
         bParseAsHlsl,
         bindingIndicesInfo,
         vFoundAdditionalPushConstants,
-        vAdditionalIncludeDirectories);
-    if (std::holds_alternative<Error>(result)) [[unlikely]] {
-        return std::get<Error>(std::move(result));
+        options,
+        parseResult.sFullSourceCode,
+        includeCache);
+    if (optionalParseError.has_value()) [[unlikely]] {
+        return std::move(optionalParseError.value());
+    }
+
+#if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
+    // Reuse previously assigned binding indices.
+    if (!options.pathToBindingLockFile.empty()) {
+        auto optionalError =
+            loadBindingLockFile(options.pathToBindingLockFile, pathToShaderSourceFile, bindingIndicesInfo);
+        if (optionalError.has_value()) [[unlikely]] {
+            return optionalError.value();
+        }
     }
-    auto sFullParsedSourceCode = std::get<std::string>(std::move(result));
+#endif
 
     // Finalize.
     auto optionalError = finalizeParsingResults(
         pathToShaderSourceFile,
         bParseAsHlsl,
+        options,
         bindingIndicesInfo,
-        sFullParsedSourceCode,
         vFoundAdditionalPushConstants,
-        iBaseAutomaticBindingIndex);
+        parseResult);
     if (optionalError.has_value()) [[unlikely]] {
         return optionalError.value();
     }
 
-    return sFullParsedSourceCode;
+    if (!sRemoteCacheKey.empty()) {
+        // Share the results (errors of the cache are counted in its statistics).
+        std::ignore = options.pRemoteParseCache->store(sRemoteCacheKey, serializeParseResult(parseResult));
+    }
+
+    return parseResult;
 }
 
 std::variant<std::string, CombinedShaderLanguageParser::Error> CombinedShaderLanguageParser::parseHlsl(
     const std::filesystem::path& pathToShaderSourceFile,
     const std::vector<std::filesystem::path>& vAdditionalIncludeDirectories) {
-    return runParsing(pathToShaderSourceFile, true, vAdditionalIncludeDirectories);
+    ParseOptions options{};
+    options.vAdditionalIncludeDirectories = vAdditionalIncludeDirectories;
+
+    auto result = runParsing(pathToShaderSourceFile, true, options);
+    if (std::holds_alternative<Error>(result)) [[unlikely]] {
+        return std::get<Error>(std::move(result));
+    }
+
+    return std::move(std::get<ParseResult>(result).sFullSourceCode);
 }
 
 std::variant<std::string, CombinedShaderLanguageParser::Error> CombinedShaderLanguageParser::parseGlsl(
     const std::filesystem::path& pathToShaderSourceFile,
     unsigned int iBaseAutomaticBindingIndex,
     const std::vector<std::filesystem::path>& vAdditionalIncludeDirectories) {
-    return runParsing(
-        pathToShaderSourceFile, false, vAdditionalIncludeDirectories, iBaseAutomaticBindingIndex);
+    ParseOptions options{};
+    options.vAdditionalIncludeDirectories = vAdditionalIncludeDirectories;
+    options.iBaseAutomaticBindingIndex = iBaseAutomaticBindingIndex;
+
+    auto result = runParsing(pathToShaderSourceFile, false, options);
+    if (std::holds_alternative<Error>(result)) [[unlikely]] {
+        return std::get<Error>(std::move(result));
+    }
+
+    return std::move(std::get<ParseResult>(result).sFullSourceCode);
+}
+
+std::variant<CombinedShaderLanguageParser::ParseResult, CombinedShaderLanguageParser::Error>
+CombinedShaderLanguageParser::parse(
+    const std::filesystem::path& pathToShaderSourceFile, bool bParseAsHlsl, const ParseOptions& options) {
+    return runParsing(pathToShaderSourceFile, bParseAsHlsl, options);
+}
+
+std::variant<std::vector<CombinedShaderLanguageParser::ParseResult>, CombinedShaderLanguageParser::Error>
+CombinedShaderLanguageParser::parsePipeline(
+    const std::vector<std::filesystem::path>& vPathsToShaderStages,
+    bool bParseAsHlsl,
+    const ParseOptions& options) {
+    // Prepare binding indices info that will be shared between all stages.
+    BindingIndicesInfo bindingIndicesInfo{};
+    bindingIndicesInfo.bShareIndicesBetweenSameResources = true;
+    bindingIndicesInfo.bTrackGlslIndicesPerSet = options.bCompactBindingIndices;
+
+    // Parse all stages first to know all hardcoded binding indices of the pipeline.
+    std::vector<ParseResult> vParseResults(vPathsToShaderStages.size());
+    std::vector<std::vector<std::string>> vFoundAdditionalPushConstants(vPathsToShaderStages.size());
+    IncludeCacheContext includeCache{};
+    auto optionalCacheError = openIncludeCache(bParseAsHlsl, options, includeCache);
+    if (optionalCacheError.has_value()) [[unlikely]] {
+        return Error(optionalCacheError.value(), options.pathToIncludeCacheDirectory);
+    }
+    for (size_t i = 0; i < vPathsToShaderStages.size(); i++) {
+        // Included files are scanned only if caches need their content hashes.
+        size_t iEstimatedParsedSize = 0;
+        if (isCacheEnabled(options)) {
+            iEstimatedParsedSize =
+                scanSourceFile(
+                    vPathsToShaderStages[i], options.vAdditionalIncludeDirectories, includeCache.scannedFiles)
+                    .iEstimatedParsedSize;
+        } else {
+            iEstimatedParsedSize = estimateParsedSize(vPathsToShaderStages[i]);
+        }
+        vParseResults[i].sFullSourceCode.reserve(iEstimatedParsedSize);
+
+        // Each stage is a separate output.
+        includeCache.iGeneratedNameCount = 0;
+        auto optionalError = parseFile(
+            vPathsToShaderStages[i],
+            bParseAsHlsl,
+            bindingIndicesInfo,
+            vFoundAdditionalPushConstants[i],
+            options,
+            vParseResults[i].sFullSourceCode,
+            includeCache);
+        if (optionalError.has_value()) [[unlikely]] {
+            return std::move(optionalError.value());
+        }
+    }
+
+#if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
+    // Reuse previously assigned binding indices.
+    if (!options.pathToBindingLockFile.empty()) {
+        for (const auto& pathToShaderStage : vPathsToShaderStages) {
+            auto optionalError =
+                loadBindingLockFile(options.pathToBindingLockFile, pathToShaderStage, bindingIndicesInfo);
+            if (optionalError.has_value()) [[unlikely]] {
+                return optionalError.value();
+            }
+        }
+    }
+#endif
+
+    // Now finalize (assign binding indices) stage by stage.
+    for (size_t i = 0; i < vPathsToShaderStages.size(); i++) {
+        auto optionalError = finalizeParsingResults(
+            vPathsToShaderStages[i],
+            bParseAsHlsl,
+            options,
+            bindingIndicesInfo,
+            vFoundAdditionalPushConstants[i],
+            vParseResults[i]);
+        if (optionalError.has_value()) [[unlikely]] {
+            return optionalError.value();
+        }
+    }
+
+    return vParseResults;
 }
 
 std::optional<CombinedShaderLanguageParser::Error> CombinedShaderLanguageParser::processKeywordCode(
@@ -291,13 +453,464 @@ CombinedShaderLanguageParser::processMixedLanguageLine(
     return true;
 }
 
-std::variant<std::string, CombinedShaderLanguageParser::Error>
+CombinedShaderLanguageParser::ScannedFileInfo CombinedShaderLanguageParser::scanSourceFile(
+    const std::filesystem::path& pathToShaderSourceFile,
+    const std::vector<std::filesystem::path>& vAdditionalIncludeDirectories,
+    std::unordered_map<std::string, ScannedFileInfo>& scannedFiles) {
+    // See if this file was already processed.
+    const auto sPathKey = pathToShaderSourceFile.lexically_normal().string();
+    const auto it = scannedFiles.find(sPathKey);
+    if (it != scannedFiles.end()) {
+        return it->second;
+    }
+    scannedFiles[sPathKey] = {};
+
+    std::ifstream file(pathToShaderSourceFile);
+    if (!file.is_open()) {
+        return {};
+    }
+
+    ScannedFileInfo info{};
+    info.iEstimatedParsedSize = estimateParsedSize(pathToShaderSourceFile);
+    info.iContentHash = SharedIncludeCache::computeHash("");
+
+    // Add included files.
+    std::string sLineBuffer;
+    while (std::getline(file, sLineBuffer)) {
+        info.iContentHash = SharedIncludeCache::computeHash(sLineBuffer, info.iContentHash);
+        info.iContentHash = SharedIncludeCache::computeHash("\n", info.iContentHash);
+
+        if (sLineBuffer.find(sIncludeKeyword) == std::string::npos) {
+            continue;
+        }
+        auto includeResult =
+            findIncludePath(sLineBuffer, pathToShaderSourceFile, vAdditionalIncludeDirectories);
+        if (!std::holds_alternative<std::optional<std::filesystem::path>>(includeResult)) {
+            continue;
+        }
+        const auto& optionalIncludedPath = std::get<std::optional<std::filesystem::path>>(includeResult);
+        if (optionalIncludedPath.has_value()) {
+            const auto includedInfo =
+                scanSourceFile(optionalIncludedPath.value(), vAdditionalIncludeDirectories, scannedFiles);
+            info.iEstimatedParsedSize += includedInfo.iEstimatedParsedSize;
+            info.iContentHash = SharedIncludeCache::computeHash(
+                std::string_view(
+                    reinterpret_cast<const char*>(&includedInfo.iContentHash), // NOLINT
+                    sizeof(includedInfo.iContentHash)),
+                info.iContentHash);
+        }
+    }
+
+    scannedFiles[sPathKey] = info;
+    return info;
+}
+
+bool CombinedShaderLanguageParser::isCacheEnabled(const ParseOptions& options) {
+    return !options.pathToIncludeCacheDirectory.empty() || options.pMemoryIncludeCache != nullptr ||
+           options.pRemoteParseCache != nullptr;
+}
+
+size_t CombinedShaderLanguageParser::estimateParsedSize(const std::filesystem::path& pathToShaderSourceFile) {
+    std::error_code errorCode;
+    const auto iFileSize = std::filesystem::file_size(pathToShaderSourceFile, errorCode);
+    if (errorCode) {
+        return 0;
+    }
+
+    // Converted code is usually a bit longer (for example `vec4` to `float4`) so add some space,
+    // heavily converted code (or code added when finalizing) can still exceed this.
+    return static_cast<size_t>(iFileSize) + static_cast<size_t>(iFileSize) / 8; // NOLINT
+}
+
+std::optional<std::string> CombinedShaderLanguageParser::openIncludeCache(
+    bool bParseAsHlsl, const ParseOptions& options, IncludeCacheContext& context) {
+    if (!isCacheEnabled(options)) {
+        return {};
+    }
+
+    if (!options.pathToIncludeCacheDirectory.empty()) {
+        auto result =
+            SharedIncludeCache::open(options.pathToIncludeCacheDirectory, options.iIncludeCacheFileSize);
+        if (std::holds_alternative<std::string>(result)) [[unlikely]] {
+            return std::get<std::string>(std::move(result));
+        }
+        context.pSharedCache = std::get<std::unique_ptr<SharedIncludeCache>>(std::move(result));
+    }
+
+    // Collect everything (except for included files) that changes parsed code of included files.
+    context.sOptionsKey = std::format(
+        "{}\n{}\n{}\n{}",
+        getCommitHash(),
+        bParseAsHlsl ? "hlsl" : "glsl",
+        options.bRelaxedHalfPrecision,
+        static_cast<int>(options.matrixLayoutConvention));
+#if defined(ENABLE_ADDITIONAL_SHADER_CONSTANTS_KEYWORD)
+    context.sOptionsKey += "\nadditional_shader_constants";
+#endif
+#if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
+    context.sOptionsKey += "\nautomatic_binding_indices";
+#endif
+
+    // Sort values of unordered maps so that the key does not depend on the order.
+    std::vector<std::pair<std::string, unsigned int>> vWorkgroupSize(
+        options.workgroupSize.begin(), options.workgroupSize.end());
+    std::ranges::sort(vWorkgroupSize);
+    for (const auto& [sName, iValue] : vWorkgroupSize) {
+        context.sOptionsKey += std::format("\n{}={}", sName, iValue);
+    }
+    std::vector<std::pair<unsigned int, std::string>> vSpecializationConstantValues(
+        options.specializationConstantValues.begin(), options.specializationConstantValues.end());
+    std::ranges::sort(vSpecializationConstantValues);
+    for (const auto& [iConstantId, sValue] : vSpecializationConstantValues) {
+        context.sOptionsKey += std::format("\nconstant_id {}={}", iConstantId, sValue);
+    }
+
+    return {};
+}
+
+std::optional<CombinedShaderLanguageParser::Error> CombinedShaderLanguageParser::parseIncludedFile(
+    const std::filesystem::path& pathToIncludedFile,
+    bool bParseAsHlsl,
+    BindingIndicesInfo& bindingIndicesInfo,
+    std::vector<std::string>& vFoundAdditionalShaderConstants,
+    const ParseOptions& options,
+    std::string& sFullSourceCode,
+    IncludeCacheContext& includeCache) {
+    // Content hash of the file was computed while scanning files before parsing.
+    const auto sPathKey = pathToIncludedFile.lexically_normal().string();
+    const auto scannedIt = includeCache.scannedFiles.find(sPathKey);
+    if ((includeCache.pSharedCache == nullptr && options.pMemoryIncludeCache == nullptr) ||
+        scannedIt == includeCache.scannedFiles.end()) {
+        return parseFile(
+            pathToIncludedFile,
+            bParseAsHlsl,
+            bindingIndicesInfo,
+            vFoundAdditionalShaderConstants,
+            options,
+            sFullSourceCode,
+            includeCache);
+    }
+    const auto sKey =
+        std::format("{}\n{}\n{:016x}", includeCache.sOptionsKey, sPathKey, scannedIt->second.iContentHash);
+
+    // Look in the in-process cache and then in the shared cache.
+    std::shared_ptr<const std::string> pMemoryCachedData;
+    std::optional<std::string_view> optionalData;
+    if (options.pMemoryIncludeCache != nullptr) {
+        pMemoryCachedData = options.pMemoryIncludeCache->find(sKey);
+        if (pMemoryCachedData != nullptr) {
+            optionalData = *pMemoryCachedData;
+        }
+    }
+    if (!optionalData.has_value() && includeCache.pSharedCache != nullptr) {
+        optionalData = includeCache.pSharedCache->find(sKey);
+        if (optionalData.has_value() && options.pMemoryIncludeCache != nullptr) {
+            options.pMemoryIncludeCache->insert(sKey, pathToIncludedFile, std::string(optionalData.value()));
+        }
+    }
+
+    // Use the cached file if found.
+    if (optionalData.has_value()) {
+        const auto optionalCachedFile = deserializeCachedIncludedFile(optionalData.value());
+        if (optionalCachedFile.has_value()) {
+            sFullSourceCode += optionalCachedFile->sCode;
+            for (const auto& sConstants : optionalCachedFile->vAdditionalShaderConstants) {
+                vFoundAdditionalShaderConstants.emplace_back(sConstants);
+            }
+
+#if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
+            // Restore hardcoded binding indices.
+            for (const auto& sBindingLine : optionalCachedFile->vBindingLines) {
+                std::string sCodeLine(sBindingLine);
+                auto optionalError =
+                    addHardcodedBindingIndexIfFound(bParseAsHlsl, sCodeLine, bindingIndicesInfo);
+                if (optionalError.has_value()) [[unlikely]] {
+                    return Error(optionalError.value(), pathToIncludedFile);
+                }
+                if (includeCache.pRecordedBindingLines != nullptr) {
+                    includeCache.pRecordedBindingLines->push_back(std::move(sCodeLine));
+                }
+            }
+#endif
+
+            return {};
+        }
+    }
+
+    // Parse the file while recording its binding lines.
+    std::vector<std::string> vBindingLines;
+    auto* pParentBindingLines = std::exchange(includeCache.pRecordedBindingLines, &vBindingLines);
+    const auto iCodeStartPos = sFullSourceCode.size();
+    const auto iConstantsStartIndex = vFoundAdditionalShaderConstants.size();
+    const auto iGeneratedNameCountBefore = includeCache.iGeneratedNameCount;
+    auto optionalError = parseFile(
+        pathToIncludedFile,
+        bParseAsHlsl,
+        bindingIndicesInfo,
+        vFoundAdditionalShaderConstants,
+        options,
+        sFullSourceCode,
+        includeCache);
+    includeCache.pRecordedBindingLines = pParentBindingLines;
+    if (optionalError.has_value()) [[unlikely]] {
+        return optionalError;
+    }
+
+    if (pParentBindingLines != nullptr) {
+        std::ranges::copy(vBindingLines, std::back_inserter(*pParentBindingLines));
+    }
+
+    // Generated variables depend on the code around the file (their names and types), such code
+    // is not stored in caches because it can differ for another includer.
+    if (includeCache.iGeneratedNameCount != iGeneratedNameCountBefore) {
+        return {};
+    }
+
+    // Store in caches (a full shared cache is not an error).
+    auto sData = serializeCachedIncludedFile(
+        std::string_view(sFullSourceCode).substr(iCodeStartPos),
+        std::span<const std::string>(vFoundAdditionalShaderConstants).subspan(iConstantsStartIndex),
+        vBindingLines);
+    if (includeCache.pSharedCache != nullptr) {
+        includeCache.pSharedCache->insert(sKey, sData);
+    }
+    if (options.pMemoryIncludeCache != nullptr) {
+        options.pMemoryIncludeCache->insert(sKey, pathToIncludedFile, std::move(sData));
+    }
+
+    return {};
+}
+
+std::string CombinedShaderLanguageParser::makeParseResultCacheKey(
+    const ParseOptions& options, const std::string& sOptionsKey, uint64_t iContentHash) {
+    // Add options that change parse results (in addition to the parsed code).
+    auto sKey = std::format(
+        "{}\n{:016x}\n{}\n{}\n{}\n{}\n{}\n{}\n{}",
+        sOptionsKey,
+        iContentHash,
+        options.iBaseAutomaticBindingIndex,
+        options.bCollectBindingReflection,
+        options.bComputeShaderConstantsLayout,
+        options.iShaderConstantsSizeBudget,
+        options.bFailIfShaderConstantsExceedBudget,
+        options.bReorderAdditionalShaderConstants,
+        options.bCompactBindingIndices);
+    for (const auto& sGroupName : options.vSpaceGroupOrder) {
+        sKey += std::format("\nspace_group {}", sGroupName);
+    }
+    for (const auto& sInputName : options.vVertexInputOrder) {
+        sKey += std::format("\nvertex_input {}", sInputName);
+    }
+
+    return sKey;
+}
+
+std::string CombinedShaderLanguageParser::serializeParseResult(const ParseResult& parseResult) {
+    std::string sData;
+    const auto appendNumber = [&](size_t iNumber) {
+        const auto iNumber32 = static_cast<uint32_t>(iNumber);
+        sData.append(reinterpret_cast<const char*>(&iNumber32), sizeof(iNumber32)); // NOLINT
+    };
+    const auto appendString = [&](std::string_view sText) {
+        appendNumber(sText.size());
+        sData += sText;
+    };
+
+    appendString(parseResult.sFullSourceCode);
+
+    appendNumber(parseResult.vBindings.size());
+    for (const auto& binding : parseResult.vBindings) {
+        appendString(binding.sResourceName);
+        appendString(binding.sDeclaredType);
+        appendNumber(static_cast<unsigned char>(binding.registerType));
+        appendNumber(binding.iSpace);
+        appendNumber(binding.iBindingIndex);
+        appendNumber(binding.iArraySize);
+        appendNumber(static_cast<size_t>(binding.resourceKind));
+        appendNumber(binding.bIsAutoAssigned ? 1 : 0);
+    }
+
+    appendNumber(parseResult.optionalShaderConstantsLayout.has_value() ? 1 : 0);
+    if (parseResult.optionalShaderConstantsLayout.has_value()) {
+        const auto& layout = parseResult.optionalShaderConstantsLayout.value();
+        appendNumber(layout.vMembers.size());
+        for (const auto& member : layout.vMembers) {
+            appendString(member.sName);
+            appendString(member.sType);
+            appendNumber(member.iOffset);
+            appendNumber(member.iSize);
+            appendNumber(member.iArraySize);
+        }
+        appendNumber(layout.iTotalSize);
+    }
+
+    appendNumber(parseResult.vWarnings.size());
+    for (const auto& sWarning : parseResult.vWarnings) {
+        appendString(sWarning);
+    }
+
+    appendNumber(parseResult.optionalMaxBindingIndex.has_value() ? 1 : 0);
+    appendNumber(parseResult.optionalMaxBindingIndex.value_or(0));
+
+    return sData;
+}
+
+std::optional<CombinedShaderLanguageParser::ParseResult>
+CombinedShaderLanguageParser::deserializeParseResult(std::string_view sData) {
+    size_t iCurrentPos = 0;
+    bool bIsDataValid = true;
+    const auto readNumber = [&]() -> unsigned int {
+        uint32_t iNumber = 0;
+        if (sData.size() - iCurrentPos < sizeof(iNumber)) [[unlikely]] {
+            bIsDataValid = false;
+            return 0;
+        }
+        std::memcpy(&iNumber, sData.data() + iCurrentPos, sizeof(iNumber)); // NOLINT
+        iCurrentPos += sizeof(iNumber);
+        return iNumber;
+    };
+    const auto readString = [&]() -> std::string {
+        const auto iSize = readNumber();
+        if (sData.size() - iCurrentPos < iSize) [[unlikely]] {
+            bIsDataValid = false;
+            return {};
+        }
+        std::string sText(sData.substr(iCurrentPos, iSize));
+        iCurrentPos += iSize;
+        return sText;
+    };
+
+    ParseResult parseResult{};
+    parseResult.sFullSourceCode = readString();
+
+    const auto iBindingCount = readNumber();
+    for (unsigned int i = 0; i < iBindingCount && bIsDataValid; i++) {
+        ReflectedBinding binding{};
+        binding.sResourceName = readString();
+        binding.sDeclaredType = readString();
+        binding.registerType = static_cast<char>(readNumber());
+        binding.iSpace = readNumber();
+        binding.iBindingIndex = readNumber();
+        binding.iArraySize = readNumber();
+        binding.resourceKind = static_cast<ShaderResourceKind>(readNumber());
+        binding.bIsAutoAssigned = readNumber() != 0;
+        parseResult.vBindings.push_back(std::move(binding));
+    }
+
+    if (readNumber() != 0) {
+        ShaderConstantsLayout layout{};
+        const auto iMemberCount = readNumber();
+        for (unsigned int i = 0; i < iMemberCount && bIsDataValid; i++) {
+            ShaderConstantsMember member{};
+            member.sName = readString();
+            member.sType = readString();
+            member.iOffset = readNumber();
+            member.iSize = readNumber();
+            member.iArraySize = readNumber();
+            layout.vMembers.push_back(std::move(member));
+        }
+        layout.iTotalSize = readNumber();
+        parseResult.optionalShaderConstantsLayout = std::move(layout);
+    }
+
+    const auto iWarningCount = readNumber();
+    for (unsigned int i = 0; i < iWarningCount && bIsDataValid; i++) {
+        parseResult.vWarnings.push_back(readString());
+    }
+
+    const auto bHasMaxBindingIndex = readNumber() != 0;
+    const auto iMaxBindingIndex = readNumber();
+    if (bHasMaxBindingIndex) {
+        parseResult.optionalMaxBindingIndex = iMaxBindingIndex;
+    }
+
+    if (!bIsDataValid || iCurrentPos != sData.size()) [[unlikely]] {
+        return {};
+    }
+
+    return parseResult;
+}
+
+std::string CombinedShaderLanguageParser::serializeCachedIncludedFile(
+    std::string_view sCode,
+    std::span<const std::string> vAdditionalShaderConstants,
+    std::span<const std::string> vBindingLines) {
+    std::string sData;
+    const auto appendSize = [&](size_t iSize) {
+        const auto iSize32 = static_cast<uint32_t>(iSize);
+        sData.append(reinterpret_cast<const char*>(&iSize32), sizeof(iSize32)); // NOLINT
+    };
+    const auto appendString = [&](std::string_view sText) {
+        appendSize(sText.size());
+        sData += sText;
+    };
+
+    appendString(sCode);
+    for (const auto& vStrings : {vAdditionalShaderConstants, vBindingLines}) {
+        appendSize(vStrings.size());
+        for (const auto& sText : vStrings) {
+            appendString(sText);
+        }
+    }
+
+    return sData;
+}
+
+std::optional<CombinedShaderLanguageParser::CachedIncludedFile>
+CombinedShaderLanguageParser::deserializeCachedIncludedFile(std::string_view sData) {
+    size_t iCurrentPos = 0;
+    const auto readSize = [&]() -> std::optional<size_t> {
+        uint32_t iSize = 0;
+        if (sData.size() - iCurrentPos < sizeof(iSize)) [[unlikely]] {
+            return {};
+        }
+        std::memcpy(&iSize, sData.data() + iCurrentPos, sizeof(iSize)); // NOLINT
+        iCurrentPos += sizeof(iSize);
+        return iSize;
+    };
+    const auto readString = [&]() -> std::optional<std::string_view> {
+        const auto optionalSize = readSize();
+        if (!optionalSize.has_value() || sData.size() - iCurrentPos < optionalSize.value()) [[unlikely]] {
+            return {};
+        }
+        const auto sText = sData.substr(iCurrentPos, optionalSize.value());
+        iCurrentPos += sText.size();
+        return sText;
+    };
+
+    CachedIncludedFile cachedFile{};
+    const auto optionalCode = readString();
+    if (!optionalCode.has_value()) [[unlikely]] {
+        return {};
+    }
+    cachedFile.sCode = optionalCode.value();
+
+    for (auto* pStrings : {&cachedFile.vAdditionalShaderConstants, &cachedFile.vBindingLines}) {
+        const auto optionalCount = readSize();
+        if (!optionalCount.has_value()) [[unlikely]] {
+            return {};
+        }
+        for (size_t i = 0; i < optionalCount.value(); i++) {
+            const auto optionalText = readString();
+            if (!optionalText.has_value()) [[unlikely]] {
+                return {};
+            }
+            pStrings->push_back(optionalText.value());
+        }
+    }
+
+    return cachedFile;
+}
+
+std::optional<CombinedShaderLanguageParser::Error>
 CombinedShaderLanguageParser::parseFile( // NOLINT: too complex
     const std::filesystem::path& pathToShaderSourceFile,
     bool bParseAsHlsl,
     BindingIndicesInfo& bindingIndicesInfo,
     std::vector<std::string>& vFoundAdditionalShaderConstants,
-    const std::vector<std::filesystem::path>& vAdditionalIncludeDirectories) {
+    const ParseOptions& options,
+    std::string& sFullSourceCode,
+    IncludeCacheContext& includeCache) {
     // Make sure the specified path exists.
     if (!std::filesystem::exists(pathToShaderSourceFile)) [[unlikely]] {
         return Error("can't open file", pathToShaderSourceFile);
@@ -319,8 +932,26 @@ CombinedShaderLanguageParser::parseFile( // NOLINT: too complex
         return Error("can't open file", pathToShaderSourceFile);
     }
 
-    std::string sFullSourceCode;
+#if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
+    // Prepare a lambda to find hardcoded binding indices.
+    const auto findHardcodedBindingIndices = [&](std::string& sText) -> std::optional<Error> {
+        auto optionalError = addHardcodedBindingIndexIfFound(bParseAsHlsl, sText, bindingIndicesInfo);
+        if (optionalError.has_value()) [[unlikely]] {
+            return Error(optionalError.value(), pathToShaderSourceFile);
+        }
+
+        // Remember lines with bindings for the include cache.
+        if (includeCache.pRecordedBindingLines != nullptr &&
+            sText.find(bParseAsHlsl ? sHlslBindingKeyword : sGlslBindingKeyword) != std::string::npos) {
+            includeCache.pRecordedBindingLines->push_back(sText);
+        }
+
+        return {};
+    };
+#endif
+
     std::string sLineBuffer;
+    std::string sPendingNumThreads;
     while (std::getline(file, sLineBuffer)) {
 #if defined(ENABLE_ADDITIONAL_SHADER_CONSTANTS_KEYWORD)
         // Process additional push constants (if found).
@@ -344,9 +975,13 @@ CombinedShaderLanguageParser::parseFile( // NOLINT: too complex
                 }
 
                 if (bParseAsHlsl) {
-                    convertGlslTypesToHlslTypes(sText);
+                    auto convertError = convertGlslTypesToHlslTypes(
+                        sText, sFullSourceCode, options, includeCache.iGeneratedNameCount);
+                    if (convertError.has_value()) [[unlikely]] {
+                        return Error(convertError.value(), pathToShaderSourceFile);
+                    }
                 } else {
-                    auto convertError = convertHlslTypesToGlslTypes(sLineBuffer);
+                    auto convertError = convertHlslTypesToGlslTypes(sLineBuffer, options);
                     if (convertError.has_value()) [[unlikely]] {
                         return Error(convertError.value(), pathToShaderSourceFile);
                     }
@@ -376,9 +1011,9 @@ CombinedShaderLanguageParser::parseFile( // NOLINT: too complex
 
 #if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
             // Find hardcoded binding indices.
-            auto optionalError = addHardcodedBindingIndexIfFound(bParseAsHlsl, sText, bindingIndicesInfo);
+            auto optionalError = findHardcodedBindingIndices(sText);
             if (optionalError.has_value()) [[unlikely]] {
-                return Error(optionalError.value(), pathToShaderSourceFile);
+                return optionalError;
             }
 #endif
 
@@ -402,9 +1037,9 @@ CombinedShaderLanguageParser::parseFile( // NOLINT: too complex
 
 #if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
             // Process this block's content.
-            auto optionalError = addHardcodedBindingIndexIfFound(bParseAsHlsl, sText, bindingIndicesInfo);
+            auto optionalError = findHardcodedBindingIndices(sText);
             if (optionalError.has_value()) [[unlikely]] {
-                return Error(optionalError.value(), pathToShaderSourceFile);
+                return optionalError;
             }
 #endif
 
@@ -472,7 +1107,7 @@ CombinedShaderLanguageParser::parseFile( // NOLINT: too complex
 
         // Look for the include keyword.
         auto includeResult =
-            findIncludePath(sLineBuffer, pathToShaderSourceFile, vAdditionalIncludeDirectories);
+            findIncludePath(sLineBuffer, pathToShaderSourceFile, options.vAdditionalIncludeDirectories);
         if (std::holds_alternative<Error>(includeResult)) [[unlikely]] {
             return std::get<Error>(std::move(includeResult));
         }
@@ -481,392 +1116,3127 @@ CombinedShaderLanguageParser::parseFile( // NOLINT: too complex
         if (!optionalIncludedPath.has_value()) {
 #if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
             // Detect hardcoded binding indices.
-            auto optionalError =
-                addHardcodedBindingIndexIfFound(bParseAsHlsl, sLineBuffer, bindingIndicesInfo);
+            auto optionalError = findHardcodedBindingIndices(sLineBuffer);
             if (optionalError.has_value()) [[unlikely]] {
-                return Error(optionalError.value(), pathToShaderSourceFile);
+                return optionalError;
             }
 #endif
 
-            // Convert types.
-            if (bParseAsHlsl) {
-                convertGlslTypesToHlslTypes(sLineBuffer);
-            } else {
-                auto convertError = convertHlslTypesToGlslTypes(sLineBuffer);
-                if (convertError.has_value()) [[unlikely]] {
-                    return Error(convertError.value(), pathToShaderSourceFile);
-                }
+            // Convert compute workgroup size.
+            const auto bIsNumThreadsPending = !sPendingNumThreads.empty();
+            auto optionalWorkgroupSizeError =
+                convertWorkgroupSize(bParseAsHlsl, sLineBuffer, options.workgroupSize, sPendingNumThreads);
+            if (optionalWorkgroupSizeError.has_value()) [[unlikely]] {
+                return Error(optionalWorkgroupSizeError.value(), pathToShaderSourceFile);
+            }
+            if (!bIsNumThreadsPending && !sPendingNumThreads.empty() &&
+                sLineBuffer.find_first_not_of(" \t\r") == std::string::npos) {
+                // Nothing left on the line.
+                continue;
             }
 
-            // Append the line to the final source code string.
-            sFullSourceCode += sLineBuffer + "\n";
-            continue;
-        }
+            // Place the converted workgroup size right before the entry function.
+            const auto iEntryFunctionPos = findFunctionCall(sLineBuffer, "main(", 0);
+            if (bIsNumThreadsPending && iEntryFunctionPos != std::string::npos &&
+                sLineBuffer.find("//") > iEntryFunctionPos) {
+                sFullSourceCode += sPendingNumThreads;
+                sFullSourceCode += '\n';
+                sPendingNumThreads.clear();
+            }
 
-        // Parse included file.
-        auto result = parseFile(
+            // Convert specialization constants.
+            auto optionalSpecializationConstantError = convertSpecializationConstant(
+                bParseAsHlsl, sLineBuffer, options.specializationConstantValues);
+            if (optionalSpecializationConstantError.has_value()) [[unlikely]] {
+                return Error(optionalSpecializationConstantError.value(), pathToShaderSourceFile);
+            }
+
+            // Convert types.
+            auto convertError =
+                bParseAsHlsl ? convertGlslTypesToHlslTypes(
+                                   sLineBuffer, sFullSourceCode, options, includeCache.iGeneratedNameCount)
+                             : convertHlslTypesToGlslTypes(sLineBuffer, options);
+            if (convertError.has_value()) [[unlikely]] {
+                return Error(convertError.value(), pathToShaderSourceFile);
+            }
+
+            // Append the line to the final source code string.
+            sFullSourceCode += sLineBuffer;
+            sFullSourceCode += '\n';
+            continue;
+        }
+
+        // Parse included file right into the resulting code.
+        auto optionalIncludeError = parseIncludedFile(
             optionalIncludedPath.value(),
             bParseAsHlsl,
             bindingIndicesInfo,
             vFoundAdditionalShaderConstants,
-            vAdditionalIncludeDirectories);
-        if (std::holds_alternative<Error>(result)) [[unlikely]] {
-            return std::get<Error>(result);
+            options,
+            sFullSourceCode,
+            includeCache);
+        if (optionalIncludeError.has_value()) [[unlikely]] {
+            return optionalIncludeError;
         }
-        sFullSourceCode += std::get<std::string>(std::move(result));
     }
 
     file.close();
 
-    return sFullSourceCode;
+    if (!sPendingNumThreads.empty()) [[unlikely]] {
+        return Error(
+            "expected to find the `main` function after the workgroup size declaration in the same file",
+            pathToShaderSourceFile);
+    }
+
+    return {};
+}
+
+std::optional<std::pair<size_t, size_t>>
+CombinedShaderLanguageParser::findShaderConstantsBody(bool bParseAsHlsl, const std::string& sSourceCode) {
+    // Find where push constants start.
+    const auto iShaderConstantsStartPos =
+        sSourceCode.find(bParseAsHlsl ? sHlslRootConstantsKeyword : sGlslPushConstantsKeyword);
+    if (iShaderConstantsStartPos == std::string::npos) {
+        return {};
+    }
+
+    // Look for '{' and '}' after shader constants.
+    const auto iBodyStartPos = sSourceCode.find('{', iShaderConstantsStartPos);
+    const auto iBodyEndPos = sSourceCode.find('}', iShaderConstantsStartPos);
+    if (iBodyStartPos == std::string::npos || iBodyEndPos == std::string::npos || iBodyEndPos < iBodyStartPos)
+        [[unlikely]] {
+        return {};
+    }
+
+    return std::pair<size_t, size_t>{iBodyStartPos + 1, iBodyEndPos};
+}
+
+std::variant<std::optional<CombinedShaderLanguageParser::ShaderConstantsLayout>, std::string>
+CombinedShaderLanguageParser::computeShaderConstantsLayout(
+    bool bParseAsHlsl, const std::string& sSourceCode) {
+    const auto optionalBody = findShaderConstantsBody(bParseAsHlsl, sSourceCode);
+    if (!optionalBody.has_value()) {
+        return std::optional<ShaderConstantsLayout>{};
+    }
+
+    // Remove comments.
+    std::string sBody = sSourceCode.substr(optionalBody->first, optionalBody->second - optionalBody->first);
+    removeLineComments(sBody);
+
+    ShaderConstantsLayout layout{};
+
+    // Process declarations one by one.
+    size_t iDeclarationStartPos = 0;
+    while (iDeclarationStartPos < sBody.size()) {
+        auto iDeclarationEndPos = sBody.find(';', iDeclarationStartPos);
+        if (iDeclarationEndPos == std::string::npos) {
+            iDeclarationEndPos = sBody.size();
+        }
+        const auto sDeclaration =
+            std::string_view(sBody).substr(iDeclarationStartPos, iDeclarationEndPos - iDeclarationStartPos);
+        iDeclarationStartPos = iDeclarationEndPos + 1;
+
+        auto declarationResult = readShaderConstantDeclaration(sDeclaration, bParseAsHlsl);
+        if (std::holds_alternative<std::string>(declarationResult)) [[unlikely]] {
+            return std::format(
+                "unable to compute push/root constants layout, {}",
+                std::get<std::string>(std::move(declarationResult)));
+        }
+        auto optionalDeclaration =
+            std::get<std::optional<ShaderConstantDeclaration>>(std::move(declarationResult));
+        if (!optionalDeclaration.has_value()) {
+            continue;
+        }
+
+        // Place members.
+        for (auto& member : optionalDeclaration->vMembers) {
+            placeShaderConstant(layout.iTotalSize, optionalDeclaration->type, bParseAsHlsl, member);
+            layout.iTotalSize = member.iOffset + member.iSize;
+            layout.vMembers.push_back(std::move(member));
+        }
+    }
+
+    return layout;
+}
+
+std::variant<std::optional<CombinedShaderLanguageParser::ShaderConstantDeclaration>, std::string>
+CombinedShaderLanguageParser::readShaderConstantDeclaration(
+    std::string_view sDeclaration, bool bParseAsHlsl) {
+    // Split into words (also splits multiple names like `uint a, b`).
+    std::vector<std::string> vWords;
+    std::string sWord;
+    for (size_t i = 0; i <= sDeclaration.size(); i++) {
+        const char character = i < sDeclaration.size() ? sDeclaration[i] : ' ';
+        if (std::isspace(static_cast<unsigned char>(character)) != 0 || character == ',') {
+            if (!sWord.empty()) {
+                vWords.push_back(std::move(sWord));
+                sWord.clear();
+            }
+            continue;
+        }
+        sWord += character;
+    }
+    if (vWords.empty()) {
+        return std::optional<ShaderConstantDeclaration>{};
+    }
+
+    ShaderConstantDeclaration declaration{};
+
+    // Skip qualifiers.
+    bool bIsRowMajor = false;
+    size_t iTypeWordIndex = 0;
+    while (iTypeWordIndex < vWords.size() &&
+           (vWords[iTypeWordIndex] == "row_major" || vWords[iTypeWordIndex] == "column_major" ||
+            vWords[iTypeWordIndex] == "precise" || vWords[iTypeWordIndex] == "highp" ||
+            vWords[iTypeWordIndex] == "mediump" || vWords[iTypeWordIndex] == "lowp")) {
+        bIsRowMajor = bIsRowMajor || vWords[iTypeWordIndex] == "row_major";
+        declaration.sQualifiers += vWords[iTypeWordIndex] + " ";
+        iTypeWordIndex += 1;
+    }
+    if (iTypeWordIndex + 1 >= vWords.size()) [[unlikely]] {
+        return std::format("unexpected member \"{}\"", vWords[0]);
+    }
+
+    const auto& sType = vWords[iTypeWordIndex];
+    const auto optionalType = getShaderConstantType(sType, bIsRowMajor, bParseAsHlsl);
+    if (!optionalType.has_value()) [[unlikely]] {
+        return std::format("unsupported member type \"{}\"", sType);
+    }
+    declaration.type = optionalType.value();
+
+    for (size_t iNameIndex = iTypeWordIndex + 1; iNameIndex < vWords.size(); iNameIndex++) {
+        ShaderConstantsMember member{};
+        member.sType = sType;
+        member.sName = vWords[iNameIndex];
+
+        // Read array size.
+        const auto iArrayStartPos = member.sName.find('[');
+        if (iArrayStartPos != std::string::npos) {
+            auto readResult = readNumberFromString(member.sName, iArrayStartPos + 1);
+            if (std::holds_alternative<std::string>(readResult)) [[unlikely]] {
+                return std::format("unsupported array size of \"{}\"", member.sName);
+            }
+            member.iArraySize = std::get<unsigned int>(readResult);
+            member.sName.erase(iArrayStartPos);
+        }
+
+        declaration.vMembers.push_back(std::move(member));
+    }
+
+    return declaration;
+}
+
+void CombinedShaderLanguageParser::placeShaderConstant(
+    unsigned int iCurrentOffset,
+    const ShaderConstantType& type,
+    bool bParseAsHlsl,
+    ShaderConstantsMember& member) {
+    const auto roundUp = [](unsigned int iValue, unsigned int iAlignment) -> unsigned int {
+        return (iValue + iAlignment - 1) / iAlignment * iAlignment;
+    };
+
+    // Calculate size and alignment of one element.
+    const auto iVectorSize = type.iComponentSize * type.iComponentCount;
+    unsigned int iElementSize = 0;
+    unsigned int iAlignment = 0;
+    if (bParseAsHlsl) {
+        // Vectors of a matrix (and array elements) start at a new register.
+        iElementSize = iShaderConstantsRegisterSize * (type.iVectorCount - 1) + iVectorSize;
+        if (type.iVectorCount > 1 || member.iArraySize > 0) {
+            iAlignment = iShaderConstantsRegisterSize;
+        } else {
+            // A vector should not cross a register boundary.
+            const auto iRegisterEnd = roundUp(iCurrentOffset + 1, iShaderConstantsRegisterSize);
+            iAlignment = iCurrentOffset + iVectorSize > iRegisterEnd ? iShaderConstantsRegisterSize
+                                                                       : type.iComponentSize;
+        }
+    } else {
+        // 3 component vectors are aligned as 4 component vectors.
+        iAlignment = type.iComponentSize * (type.iComponentCount == 3 ? 4 : type.iComponentCount);
+        iElementSize = type.iVectorCount == 1 ? iVectorSize : iAlignment * type.iVectorCount;
+    }
+
+    // Calculate full size (in HLSL the last array element is not padded).
+    member.iSize = iElementSize;
+    if (member.iArraySize > 0) {
+        if (bParseAsHlsl) {
+            member.iSize =
+                roundUp(iElementSize, iShaderConstantsRegisterSize) * (member.iArraySize - 1) + iElementSize;
+        } else {
+            member.iSize = roundUp(iElementSize, iAlignment) * member.iArraySize;
+        }
+    }
+
+    member.iOffset = roundUp(iCurrentOffset, iAlignment);
+}
+
+#if defined(ENABLE_ADDITIONAL_SHADER_CONSTANTS_KEYWORD)
+std::optional<std::string> CombinedShaderLanguageParser::reorderAdditionalShaderConstants(
+    bool bParseAsHlsl, unsigned int iInitialOffset, std::vector<std::string>& vAdditionalShaderConstants) {
+    // Collect all additional members.
+    std::string sAllConstants;
+    for (const auto& sConstants : vAdditionalShaderConstants) {
+        sAllConstants += sConstants;
+        sAllConstants += '\n';
+    }
+    removeLineComments(sAllConstants);
+
+    // Split into separate members.
+    std::vector<ShaderConstantDeclaration> vDeclarations;
+    size_t iDeclarationStartPos = 0;
+    while (iDeclarationStartPos < sAllConstants.size()) {
+        auto iDeclarationEndPos = sAllConstants.find(';', iDeclarationStartPos);
+        if (iDeclarationEndPos == std::string::npos) {
+            iDeclarationEndPos = sAllConstants.size();
+        }
+        const auto sDeclaration = std::string_view(sAllConstants).substr(
+            iDeclarationStartPos, iDeclarationEndPos - iDeclarationStartPos);
+        iDeclarationStartPos = iDeclarationEndPos + 1;
+
+        auto declarationResult = readShaderConstantDeclaration(sDeclaration, bParseAsHlsl);
+        if (std::holds_alternative<std::string>(declarationResult)) [[unlikely]] {
+            return std::format(
+                "unable to reorder additional push/root constants, {}",
+                std::get<std::string>(std::move(declarationResult)));
+        }
+        auto optionalDeclaration =
+            std::get<std::optional<ShaderConstantDeclaration>>(std::move(declarationResult));
+        if (!optionalDeclaration.has_value()) {
+            continue;
+        }
+
+        for (auto& member : optionalDeclaration->vMembers) {
+            ShaderConstantDeclaration separateMember{};
+            separateMember.sQualifiers = optionalDeclaration->sQualifiers;
+            separateMember.type = optionalDeclaration->type;
+            separateMember.vMembers.push_back(std::move(member));
+            vDeclarations.push_back(std::move(separateMember));
+        }
+    }
+
+    // Calculate size with the original order.
+    unsigned int iOriginalSize = iInitialOffset;
+    for (auto& declaration : vDeclarations) {
+        auto& member = declaration.vMembers[0];
+        placeShaderConstant(iOriginalSize, declaration.type, bParseAsHlsl, member);
+        iOriginalSize = member.iOffset + member.iSize;
+    }
+
+    // Each time pick a member that needs the least padding (bigger members first).
+    std::vector<size_t> vNewOrder;
+    std::vector<bool> vIsPlaced(vDeclarations.size(), false);
+    unsigned int iNewSize = iInitialOffset;
+    while (vNewOrder.size() < vDeclarations.size()) {
+        std::optional<size_t> optionalBestIndex;
+        unsigned int iBestPadding = 0;
+        for (size_t i = 0; i < vDeclarations.size(); i++) {
+            if (vIsPlaced[i]) {
+                continue;
+            }
+            auto& member = vDeclarations[i].vMembers[0];
+            placeShaderConstant(iNewSize, vDeclarations[i].type, bParseAsHlsl, member);
+
+            const auto iPadding = member.iOffset - iNewSize;
+            if (!optionalBestIndex.has_value() || iPadding < iBestPadding ||
+                (iPadding == iBestPadding &&
+                 member.iSize > vDeclarations[*optionalBestIndex].vMembers[0].iSize)) {
+                optionalBestIndex = i;
+                iBestPadding = iPadding;
+            }
+        }
+
+        // Place it.
+        auto& member = vDeclarations[*optionalBestIndex].vMembers[0];
+        placeShaderConstant(iNewSize, vDeclarations[*optionalBestIndex].type, bParseAsHlsl, member);
+        iNewSize = member.iOffset + member.iSize;
+        vIsPlaced[*optionalBestIndex] = true;
+        vNewOrder.push_back(*optionalBestIndex);
+    }
+
+    if (iNewSize >= iOriginalSize) {
+        return {};
+    }
+
+    // Declare members in the new order.
+    vAdditionalShaderConstants.clear();
+    for (const auto iMemberIndex : vNewOrder) {
+        const auto& declaration = vDeclarations[iMemberIndex];
+        const auto& member = declaration.vMembers[0];
+        vAdditionalShaderConstants.push_back(std::format(
+            "{}{} {}{};\n",
+            declaration.sQualifiers,
+            member.sType,
+            member.sName,
+            member.iArraySize > 0 ? std::format("[{}]", member.iArraySize) : ""));
+    }
+
+    return {};
+}
+#endif
+
+void CombinedShaderLanguageParser::removeLineComments(std::string& sCode) {
+    for (auto iCommentPos = sCode.find("//"); iCommentPos != std::string::npos;
+         iCommentPos = sCode.find("//", iCommentPos)) {
+        sCode.erase(iCommentPos, sCode.find('\n', iCommentPos) - iCommentPos);
+    }
+}
+
+std::optional<CombinedShaderLanguageParser::ShaderConstantType>
+CombinedShaderLanguageParser::getShaderConstantType(
+    std::string_view sType, bool bIsRowMajor, bool bParseAsHlsl) {
+    ShaderConstantType type{};
+
+    // Scalar type.
+    constexpr std::array<std::pair<std::string_view, unsigned int>, 13> vScalarPrefixes = {{
+        {"double", 8},     // NOLINT: 64 bit scalar
+        {"float16_t", 2},  // NOLINT: 16 bit scalar
+        {"half", 2},       // NOLINT
+        {"min16float", 2}, // NOLINT
+        {"f16vec", 2},     // NOLINT
+        {"float", 4},      // NOLINT
+        {"uint", 4},       // NOLINT
+        {"int", 4},        // NOLINT
+        {"bool", 4},       // NOLINT
+        {"dvec", 8},       // NOLINT
+        {"uvec", 4},       // NOLINT
+        {"ivec", 4},       // NOLINT
+        {"bvec", 4},       // NOLINT
+    }};
+    std::string_view sDimensions;
+    std::string sSquareDimensions;
+    bool bFoundPrefix = false;
+    for (const auto& [sPrefix, iSize] : vScalarPrefixes) {
+        if (sType.starts_with(sPrefix)) {
+            type.iComponentSize = iSize;
+            sDimensions = sType.substr(sPrefix.size());
+            bFoundPrefix = true;
+            break;
+        }
+    }
+    if (!bFoundPrefix) {
+        if (sType.starts_with("vec")) {
+            sDimensions = sType.substr(3); // NOLINT: size of the prefix
+        } else if (sType.starts_with("dmat")) {
+            type.iComponentSize = 8; // NOLINT: 64 bit scalar
+            sDimensions = sType.substr(4); // NOLINT: size of the prefix
+            if (sDimensions.size() == 1) {
+                sSquareDimensions = std::format("{}x{}", sDimensions, sDimensions);
+                sDimensions = sSquareDimensions;
+            }
+        } else if (sType.starts_with("f16mat")) {
+            type.iComponentSize = 2; // NOLINT: 16 bit scalar
+            sDimensions = sType.substr(6); // NOLINT: size of the prefix
+            if (sDimensions.size() == 1) {
+                sSquareDimensions = std::format("{}x{}", sDimensions, sDimensions);
+                sDimensions = sSquareDimensions;
+            }
+        } else if (sType.starts_with("mat")) {
+            sDimensions = sType.substr(3); // NOLINT: size of the prefix
+        } else {
+            return {};
+        }
+    }
+
+    // Read dimensions.
+    const auto isDimension = [](char character) { return character >= '1' && character <= '4'; };
+    if (sDimensions.empty()) {
+        return type;
+    }
+    if (sDimensions.size() == 1 && isDimension(sDimensions[0])) {
+        const auto iDimension = static_cast<unsigned int>(sDimensions[0] - '0');
+        if (sType.starts_with("mat")) {
+            // Square GLSL matrix.
+            type.iComponentCount = iDimension;
+            type.iVectorCount = iDimension;
+        } else {
+            type.iComponentCount = iDimension;
+        }
+        return type;
+    }
+    if (sDimensions.size() == 3 && isDimension(sDimensions[0]) && sDimensions[1] == 'x' &&
+        isDimension(sDimensions[2])) {
+        auto iFirst = static_cast<unsigned int>(sDimensions[0] - '0');
+        auto iSecond = static_cast<unsigned int>(sDimensions[2] - '0');
+
+        // GLSL specifies columns x rows, HLSL rows x columns, store as column vectors.
+        unsigned int iRows = bParseAsHlsl ? iFirst : iSecond;
+        unsigned int iColumns = bParseAsHlsl ? iSecond : iFirst;
+        if (bIsRowMajor) {
+            std::swap(iRows, iColumns);
+        }
+
+        type.iComponentCount = iRows;
+        type.iVectorCount = iColumns;
+        return type;
+    }
+
+    return {};
 }
 
-void CombinedShaderLanguageParser::convertGlslTypesToHlslTypes(std::string& sGlslLine) {
+std::optional<std::string> CombinedShaderLanguageParser::convertGlslTypesToHlslTypes(
+    std::string& sGlslLine,
+    std::string_view sPrecedingCode,
+    const ParseOptions& options,
+    size_t& iGeneratedNameCount) {
+    const auto bTransposeMatrices = options.matrixLayoutConvention == MatrixLayoutConvention::ROW_MAJOR;
+
     // Vectors.
     replaceKeyword(sGlslLine, "vec2", "float2");
     replaceKeyword(sGlslLine, "vec3", "float3");
     replaceKeyword(sGlslLine, "vec4", "float4");
 
-    // Matrices.
-    replaceKeyword(sGlslLine, "mat2", "float2x2");
-    replaceKeyword(sGlslLine, "mat3", "float3x3");
-    replaceKeyword(sGlslLine, "mat4", "float4x4");
+    // Matrices (GLSL specifies columns x rows, HLSL rows x columns).
+    const std::string_view sHalf = options.bRelaxedHalfPrecision ? "min16float" : "half";
+    for (const auto iColumns : {2, 3, 4}) {
+        for (const auto iRows : {2, 3, 4}) {
+            const auto iHlslRows = bTransposeMatrices ? iColumns : iRows;
+            const auto iHlslColumns = bTransposeMatrices ? iRows : iColumns;
+            replaceKeyword(
+                sGlslLine,
+                std::format("mat{}x{}", iColumns, iRows),
+                std::format("float{}x{}", iHlslRows, iHlslColumns));
+            replaceKeyword(
+                sGlslLine,
+                std::format("f16mat{}x{}", iColumns, iRows),
+                std::format("{}{}x{}", sHalf, iHlslRows, iHlslColumns));
+        }
+        replaceKeyword(
+            sGlslLine, std::format("mat{}", iColumns), std::format("float{}x{}", iColumns, iColumns));
+        replaceKeyword(
+            sGlslLine, std::format("f16mat{}", iColumns), std::format("{}{}x{}", sHalf, iColumns, iColumns));
+    }
+
+    // 16 bit floats.
+    replaceKeyword(sGlslLine, "float16_t", sHalf);
+    for (const auto sDimension : {"2", "3", "4"}) {
+        replaceKeyword(
+            sGlslLine, std::format("f16vec{}", sDimension), std::format("{}{}", sHalf, sDimension));
+    }
 
     // Cast functions.
     replaceKeyword(sGlslLine, "floatBitsToUint(", "asuint(");
     replaceKeyword(sGlslLine, "uintBitsToFloat(", "asfloat(");
 
+    // Compute sync functions.
+    for (const auto& barrier : vGlslToHlslBarriers) {
+        replaceKeyword(sGlslLine, barrier.sGlslName, barrier.sHlslName);
+    }
+
     // Atomic functions.
-    replaceKeyword(sGlslLine, "atomicMin(", "InterlockedMin(");
-    replaceKeyword(sGlslLine, "atomicMax(", "InterlockedMax(");
+    auto optionalError = convertGlslAtomicsToHlsl(sGlslLine, sPrecedingCode, iGeneratedNameCount);
+    if (optionalError.has_value()) [[unlikely]] {
+        return optionalError;
+    }
+
+    // Loop and branch hints.
+    convertControlFlowAttributes(true, sGlslLine);
+
+    // Bit manipulation functions (packing functions are emulated using helper functions).
+    replaceKeyword(sGlslLine, "bitCount(", "countbits(");
+    replaceKeyword(sGlslLine, "findMSB(", "firstbithigh(");
+    replaceKeyword(sGlslLine, "findLSB(", "firstbitlow(");
+    replaceKeyword(sGlslLine, "bitfieldReverse(", "reversebits(");
 
-    // Replacing `matnxm` will be wrong since GLSL and HLSL have different row/column specification.
-    // TODO: think about this in the future
+    // Subgroup operations (composed first because they contain simple ones).
+    for (const auto& intrinsic : vComposedSubgroupIntrinsics) {
+        replaceNestedFunctionCall(sGlslLine, intrinsic.sGlslName, intrinsic.sHlslName);
+    }
+    for (const auto& intrinsic : vSubgroupIntrinsics) {
+        replaceKeyword(sGlslLine, intrinsic.sGlslName, intrinsic.sHlslName);
+    }
 
     if (sGlslLine.starts_with(
             "shared ")) { // avoid replacing `groupshared` to `groupgroupshared` because it matches `shared`
         replaceKeyword(sGlslLine, "shared ", "groupshared ");
     }
+
+    return {};
 }
 
-std::optional<std::string> CombinedShaderLanguageParser::convertHlslTypesToGlslTypes(std::string& sHlslLine) {
+std::optional<std::string> CombinedShaderLanguageParser::convertHlslTypesToGlslTypes(
+    std::string& sHlslLine, const ParseOptions& options) {
+    const auto bTransposeMatrices = options.matrixLayoutConvention == MatrixLayoutConvention::ROW_MAJOR;
+
     // `mul` to `operator*`.
-    auto optionalError = replaceHlslMulToGlsl(sHlslLine);
+    auto optionalError = replaceHlslMulToGlsl(sHlslLine, bTransposeMatrices);
     if (optionalError.has_value()) [[unlikely]] {
         return optionalError;
     }
 
     // Replace compute sync functions.
-    replaceKeyword(sHlslLine, "GroupMemoryBarrierWithGroupSync();", "groupMemoryBarrier(); barrier();");
-
-    return {};
-}
-
-#if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
-std::optional<std::string> CombinedShaderLanguageParser::assignBindingIndices( // NOLINT: slightly complex
-    bool bParseAsHlsl,
-    std::string& sFullSourceCode,
-    BindingIndicesInfo& bindingIndicesInfo,
-    unsigned int iBaseAutomaticBindingIndex) {
-    if (bParseAsHlsl) {
-        // Prepare some variables.
-        size_t iCurrentPos = 0;
-        std::unordered_map<char, std::unordered_map<unsigned int, unsigned int>> nextFreeBindingIndex;
+    for (const auto& barrier : vHlslToGlslBarriers) {
+        replaceKeyword(sHlslLine, barrier.sHlslName, barrier.sGlslName);
+    }
 
-        // Initialize base binding indices.
-        const std::array<char, 4> vRegisterTypes = {'t', 's', 'u', 'b'};
-        for (const auto& registerType : vRegisterTypes) {
-            auto& registerSpaceIndexIt = nextFreeBindingIndex[registerType];
-            for (unsigned int i = 0; i < 9; i++) { // NOLINT: iterate over all spaces
-                registerSpaceIndexIt[i] = 0;
+    // Atomic functions.
+    convertHlslAtomicsToGlsl(sHlslLine);
+
+    // Loop and branch hints.
+    convertControlFlowAttributes(false, sHlslLine);
+
+    // Bit manipulation functions.
+    replaceKeyword(sHlslLine, "countbits(", "bitCount(");
+    replaceKeyword(sHlslLine, "firstbithigh(", "findMSB(");
+    replaceKeyword(sHlslLine, "firstbitlow(", "findLSB(");
+    replaceKeyword(sHlslLine, "reversebits(", "bitfieldReverse(");
+
+    // 16 bit floats (matrices and vectors first because they start with the scalar type).
+    for (const auto sHalf : {"half", "min16float"}) {
+        for (const auto iRows : {2, 3, 4}) {
+            for (const auto iColumns : {2, 3, 4}) {
+                // HLSL specifies rows x columns, GLSL columns x rows.
+                auto sGlslMatrix = std::format("f16mat{}", iRows);
+                if (iRows != iColumns) {
+                    sGlslMatrix = bTransposeMatrices ? std::format("f16mat{}x{}", iRows, iColumns)
+                                                     : std::format("f16mat{}x{}", iColumns, iRows);
+                }
+                replaceKeyword(sHlslLine, std::format("{}{}x{}", sHalf, iRows, iColumns), sGlslMatrix);
             }
+            replaceKeyword(sHlslLine, std::format("{}{}", sHalf, iRows), std::format("f16vec{}", iRows));
         }
+        replaceKeyword(sHlslLine, sHalf, "float16_t");
+    }
 
-        do {
-            // Prepare some variables.
-            bool bSkipCurrentRegister = false;
-            char registerType = '0';
-            unsigned int iRegisterSpace = 0; // default space if not specified
-            size_t iRegisterIndexPositionToReplace = 0;
-
-            // Find register values.
-            auto optionalError = findHlslRegisterInfo(
-                sFullSourceCode,
-                iCurrentPos,
-                [&]() -> std::optional<std::string> {
-                    // Reached register type.
-                    registerType = sFullSourceCode[iCurrentPos];
-
-                    return {};
-                },
-                [&]() -> std::optional<std::string> {
-                    // Reached register index.
-
-                    // Make sure it's our keyword.
-                    if (sFullSourceCode[iCurrentPos] != assignBindingIndexCharacter) {
-                        // Found hardcoded index.
-                        bSkipCurrentRegister = true;
-                        return {};
-                    }
-
-                    // Save this position.
-                    iRegisterIndexPositionToReplace = iCurrentPos;
-
-                    return {};
-                },
-                [&]() -> std::optional<std::string> {
-                    if (bSkipCurrentRegister) {
-                        return {};
-                    }
+    // Wave operations.
+    for (const auto& intrinsic : vComposedSubgroupIntrinsics) {
+        replaceNestedFunctionCall(sHlslLine, intrinsic.sHlslName, intrinsic.sGlslName);
+    }
+    for (const auto& intrinsic : vSubgroupIntrinsics) {
+        replaceKeyword(sHlslLine, intrinsic.sHlslName, intrinsic.sGlslName);
+    }
 
-                    if (sFullSourceCode[iCurrentPos] == assignBindingIndexCharacter) [[unlikely]] {
-                        return "`space?` is not supported";
-                    }
+    return {};
+}
 
-                    // Reached register space.
-                    auto readResult = readNumberFromString(sFullSourceCode, iCurrentPos);
-                    if (std::holds_alternative<std::string>(readResult)) [[unlikely]] {
-                        return std::get<std::string>(std::move(readResult));
-                    }
-                    iRegisterSpace = std::get<unsigned int>(readResult);
+void CombinedShaderLanguageParser::replaceNestedFunctionCall(
+    std::string& sText, std::string_view sReplaceFrom, std::string_view sReplaceTo) {
+    const auto iFromCallCount = std::ranges::count(sReplaceFrom, '(');
+    const auto iToCallCount = std::ranges::count(sReplaceTo, '(');
+    const auto iCommentStartPos = sText.find("//");
 
-                    return {};
-                });
-            if (optionalError.has_value()) [[unlikely]] {
-                return optionalError;
-            }
+    size_t iCurrentPosition = 0;
+    while ((iCurrentPosition = findFunctionCall(sText, sReplaceFrom, iCurrentPosition)) !=
+           std::string::npos) {
+        if (iCommentStartPos != std::string::npos && iCommentStartPos < iCurrentPosition) {
+            // Part of a comment.
+            return;
+        }
 
-            if (iCurrentPos == std::string::npos) {
-                // Found nothing.
-                return {};
-            }
+        // Find closing parenthesis of the innermost call.
+        const auto iClosePosition = findClosingParenthesis(sText, iCurrentPosition + sReplaceFrom.size());
+        if (iClosePosition == std::string::npos) {
+            // The call continues on the next line, keep it as is.
+            return;
+        }
 
-            if (bSkipCurrentRegister) {
+        // Balance closing parentheses of outer calls.
+        if (iToCallCount > iFromCallCount) {
+            sText.insert(iClosePosition, static_cast<size_t>(iToCallCount - iFromCallCount), ')');
+        } else if (iToCallCount < iFromCallCount) {
+            const auto iRemoveCount = static_cast<size_t>(iFromCallCount - iToCallCount);
+            if (sText.compare(iClosePosition + 1, iRemoveCount, std::string(iRemoveCount, ')')) != 0) {
+                // Outer calls have more arguments, can't convert.
+                iCurrentPosition += 1;
                 continue;
             }
+            sText.erase(iClosePosition + 1, iRemoveCount);
+        }
 
-            // Get space/index from free indices.
-            const auto registerSpaceIndexIt = nextFreeBindingIndex.find(registerType);
-            if (registerSpaceIndexIt == nextFreeBindingIndex.end()) [[unlikely]] {
-                return std::format("found unexpected register type `{}`", registerType);
-            }
+        sText.replace(iCurrentPosition, sReplaceFrom.size(), sReplaceTo);
+        iCurrentPosition += sReplaceTo.size();
+    }
+}
 
-            // Get free index.
-            auto registerIndexIt = registerSpaceIndexIt->second.find(iRegisterSpace);
-            if (registerIndexIt == registerSpaceIndexIt->second.end()) [[unlikely]] {
-                return std::format("found unexpected register space {}", iRegisterSpace);
-            }
-            auto& iNextFreeRegisterIndex = registerIndexIt->second;
+size_t CombinedShaderLanguageParser::findFunctionCall(
+    const std::string& sText, std::string_view sName, size_t iStartPos) {
+    for (auto iPos = sText.find(sName, iStartPos); iPos != std::string::npos;
+         iPos = sText.find(sName, iPos + 1)) {
+        if (iPos == 0 ||
+            (std::isalnum(static_cast<unsigned char>(sText[iPos - 1])) == 0 && sText[iPos - 1] != '_')) {
+            return iPos;
+        }
+    }
 
-            // Make sure this index was not used before.
-            const auto& usedIndices = bindingIndicesInfo.usedHlslIndices[registerType][iRegisterSpace];
+    return std::string::npos;
+}
 
-            // Update our index to assign to unused (free) index.
-            bool bFoundUnusedIndex = true;
-            do {
-                bFoundUnusedIndex = true;
+size_t CombinedShaderLanguageParser::findClosingParenthesis(const std::string& sText, size_t iStartPos) {
+    size_t iDepth = 1;
+    for (size_t i = iStartPos; i < sText.size(); i++) {
+        if (sText[i] == '(') {
+            iDepth += 1;
+        } else if (sText[i] == ')') {
+            iDepth -= 1;
+            if (iDepth == 0) {
+                return i;
+            }
+        }
+    }
 
-                for (const auto iUsedIndex : usedIndices) {
-                    if (iUsedIndex == iNextFreeRegisterIndex) {
-                        iNextFreeRegisterIndex += 1;
-                        bFoundUnusedIndex = false;
-                        break;
-                    }
-                }
-            } while (!bFoundUnusedIndex);
+    return std::string::npos;
+}
 
-            // Replace our special character with this index.
-            sFullSourceCode.erase(iRegisterIndexPositionToReplace, 1);
-            sFullSourceCode.insert(iRegisterIndexPositionToReplace, std::to_string(iNextFreeRegisterIndex));
+std::vector<std::string> CombinedShaderLanguageParser::splitFunctionArguments(std::string_view sArguments) {
+    std::vector<std::string> vArguments;
+    size_t iArgumentStartPos = 0;
+    const auto addArgument = [&](size_t iArgumentEndPos) {
+        const auto sArgument = sArguments.substr(iArgumentStartPos, iArgumentEndPos - iArgumentStartPos);
+        const auto iFirstCharPos = sArgument.find_first_not_of(" \t");
+        const auto iLastCharPos = sArgument.find_last_not_of(" \t");
+        vArguments.emplace_back(
+            iFirstCharPos == std::string_view::npos
+                ? std::string_view()
+                : sArgument.substr(iFirstCharPos, iLastCharPos - iFirstCharPos + 1));
+        iArgumentStartPos = iArgumentEndPos + 1;
+    };
 
-            // Update current position (because we might have changed string length).
-            iCurrentPos = iRegisterIndexPositionToReplace;
+    size_t iDepth = 0;
+    for (size_t i = 0; i < sArguments.size(); i++) {
+        const auto character = sArguments[i];
+        if (character == '(' || character == '[') {
+            iDepth += 1;
+        } else if ((character == ')' || character == ']') && iDepth > 0) {
+            iDepth -= 1;
+        } else if (character == ',' && iDepth == 0) {
+            addArgument(i);
+        }
+    }
+    addArgument(sArguments.size());
 
-            // Increment next free binding index (because the current one was assigned just now).
-            iNextFreeRegisterIndex += 1;
-        } while (iCurrentPos < sFullSourceCode.size());
+    return vArguments;
+}
 
+std::optional<std::string_view> CombinedShaderLanguageParser::findAtomicValueType(
+    std::string_view sFirstArgument, std::string_view sPrecedingCode) {
+    // Get the variable name (`counter` from `data.counter` or `counters[id]`).
+    auto iNameEndPos = sFirstArgument.find('[');
+    if (iNameEndPos == std::string_view::npos) {
+        iNameEndPos = sFirstArgument.size();
+    }
+    auto sName = sFirstArgument.substr(0, iNameEndPos);
+    const auto iMemberPos = sName.find_last_of('.');
+    if (iMemberPos != std::string_view::npos) {
+        sName = sName.substr(iMemberPos + 1);
+    }
+    const auto isNameChar = [](char character) {
+        return std::isalnum(static_cast<unsigned char>(character)) != 0 || character == '_';
+    };
+    if (sName.empty() || !std::ranges::all_of(sName, isNameChar)) [[unlikely]] {
         return {};
     }
 
-    // Parse as GLSL.
-    size_t iCurrentPos = 0;
-    unsigned int iNextFreeBindingIndex = iBaseAutomaticBindingIndex;
+    // Look for the closest declaration like `int name`, `uint name` or `RWStructuredBuffer<int> name`.
+    auto iNamePos = sPrecedingCode.rfind(sName);
+    for (; iNamePos != std::string_view::npos && iNamePos != 0;
+         iNamePos = sPrecedingCode.rfind(sName, iNamePos - 1)) {
+        const auto iNameEnd = iNamePos + sName.size();
+        if (isNameChar(sPrecedingCode[iNamePos - 1]) ||
+            (iNameEnd < sPrecedingCode.size() && isNameChar(sPrecedingCode[iNameEnd]))) {
+            continue;
+        }
 
-    do {
-        size_t iBindingIndexPositionToReplace = 0;
-        bool bSkipThisBinding = false;
+        auto iTypeEndPos = sPrecedingCode.find_last_not_of(" \t\n", iNamePos - 1);
+        if (iTypeEndPos == std::string_view::npos) {
+            continue;
+        }
+        if (sPrecedingCode[iTypeEndPos] == '>' && iTypeEndPos != 0) {
+            iTypeEndPos -= 1;
+        }
+        size_t iTypeStartPos = iTypeEndPos + 1;
+        while (iTypeStartPos > 0 && isNameChar(sPrecedingCode[iTypeStartPos - 1])) {
+            iTypeStartPos -= 1;
+        }
+        const auto sType = sPrecedingCode.substr(iTypeStartPos, iTypeEndPos + 1 - iTypeStartPos);
+        if (sType == "int") {
+            return "int";
+        }
+        if (sType == "uint") {
+            return "uint";
+        }
+    }
 
-        auto optionalError =
-            findGlslBindingIndex(sFullSourceCode, iCurrentPos, [&]() -> std::optional<std::string> {
-                // Make sure this is our special assignment character.
-                if (sFullSourceCode[iCurrentPos] != assignBindingIndexCharacter) {
-                    bSkipThisBinding = true;
-                    return {};
+    return {};
+}
+
+bool CombinedShaderLanguageParser::isAfterStatementEnd(std::string_view sPrecedingCode) {
+    while (!sPrecedingCode.empty()) {
+        // Take the last line.
+        if (sPrecedingCode.back() == '\n') {
+            sPrecedingCode.remove_suffix(1);
+        }
+        const auto iLineStartPos = sPrecedingCode.find_last_of('\n');
+        auto sLine = iLineStartPos == std::string_view::npos ? sPrecedingCode
+                                                             : sPrecedingCode.substr(iLineStartPos + 1);
+        sPrecedingCode.remove_suffix(sLine.size());
+
+        // Ignore comments, empty lines and preprocessor directives.
+        sLine = sLine.substr(0, sLine.find("//"));
+        const auto iFirstCharPos = sLine.find_first_not_of(" \t\r");
+        if (iFirstCharPos == std::string_view::npos || sLine[iFirstCharPos] == '#') {
+            continue;
+        }
+        const auto iLastCharPos = sLine.find_last_not_of(" \t\r");
+        return std::string_view(";{}:").find(sLine[iLastCharPos]) != std::string_view::npos ||
+               sLine.substr(0, iLastCharPos + 1).ends_with("*/");
+    }
+
+    return true;
+}
+
+std::optional<std::string> CombinedShaderLanguageParser::convertGlslAtomicsToHlsl( // NOLINT
+    std::string& sGlslLine, std::string_view sPrecedingCode, size_t& iGeneratedNameCount) {
+    const auto trim = [](std::string_view sText) -> std::string {
+        const auto iFirstCharPos = sText.find_first_not_of(" \t");
+        if (iFirstCharPos == std::string_view::npos) {
+            return "";
+        }
+        return std::string(sText.substr(iFirstCharPos, sText.find_last_not_of(" \t") - iFirstCharPos + 1));
+    };
+
+    const auto isIdentifierCharacter = [](char character) {
+        return std::isalnum(static_cast<unsigned char>(character)) != 0 || character == '_';
+    };
+
+    size_t iSearchPos = 0;
+    while (true) {
+        // Find the first atomic call.
+        size_t iCallPos = std::string::npos;
+        const AtomicFunction* pAtomic = nullptr;
+        for (const auto& atomic : vAtomicFunctions) {
+            const auto iPos = findFunctionCall(sGlslLine, atomic.sGlslName, iSearchPos);
+            if (iPos < iCallPos) {
+                iCallPos = iPos;
+                pAtomic = &atomic;
+            }
+        }
+        const auto iCommentStartPos = sGlslLine.find("//");
+        if (pAtomic == nullptr || (iCommentStartPos != std::string::npos && iCommentStartPos < iCallPos)) {
+            return {};
+        }
+        iSearchPos = iCallPos + 1;
+
+        // Find arguments.
+        const auto iArgumentsPos = iCallPos + pAtomic->sGlslName.size();
+        const auto iClosePos = findClosingParenthesis(sGlslLine, iArgumentsPos);
+        if (iClosePos == std::string::npos) {
+            // The call continues on the next line.
+            continue;
+        }
+        const auto sArguments = sGlslLine.substr(iArgumentsPos, iClosePos - iArgumentsPos);
+        const auto vArguments = splitFunctionArguments(sArguments);
+        if (vArguments.size() != pAtomic->iGlslArgumentCount) {
+            continue;
+        }
+        const auto makeCall = [&](std::string_view sOriginalValue) {
+            if (sOriginalValue.empty()) {
+                return std::format("{}{});", pAtomic->sHlslNameWithoutResult, sArguments);
+            }
+            return std::format("{}{}, {});", pAtomic->sHlslName, sArguments, sOriginalValue);
+        };
+
+        const auto makeError = [&](std::string_view sReason) {
+            return std::format(
+                "unable to convert \"{}{})\" because {}", pAtomic->sGlslName, sArguments, sReason);
+        };
+
+        // Find the statement that contains the call (skipping `;` inside of parentheses like in `for (...)`)
+        // and make sure that the call is not inside of the parentheses of `for`.
+        std::optional<size_t> optionalStatementStartPos;
+        int iParenthesisDepth = 0;
+        for (size_t iPos = iCallPos; iPos > 0; iPos--) {
+            const auto character = sGlslLine[iPos - 1];
+            if (character == ')') {
+                iParenthesisDepth += 1;
+            } else if (character == '(') {
+                iParenthesisDepth -= 1;
+                const auto iKeywordEndPos =
+                    iPos < 2 ? std::string::npos : sGlslLine.find_last_not_of(" \t", iPos - 2);
+                if (iParenthesisDepth < 0 && iKeywordEndPos != std::string::npos &&
+                    std::string_view(sGlslLine).substr(0, iKeywordEndPos + 1).ends_with("for") &&
+                    (iKeywordEndPos < 3 || !isIdentifierCharacter(sGlslLine[iKeywordEndPos - 3])))
+                    [[unlikely]] {
+                    return makeError(
+                        "it's used in a `for` loop header, store the result in a variable before the loop");
+                }
+            } else if ((character == '{' || character == '}') && iParenthesisDepth <= 0) {
+                optionalStatementStartPos = optionalStatementStartPos.value_or(iPos);
+                break;
+            } else if (character == ';' && iParenthesisDepth == 0 && !optionalStatementStartPos.has_value()) {
+                optionalStatementStartPos = iPos;
+            }
+        }
+        auto iStatementStartPos = optionalStatementStartPos.value_or(0);
+        iStatementStartPos = sGlslLine.find_first_not_of(" \t", iStatementStartPos);
+
+        // A statement at the start of the line is the body of a control statement on a previous line
+        // (like `if (...)` or `else`) or continues an expression unless the previous code ends a statement.
+        bool bIsInConditionalBody =
+            iStatementStartPos == sGlslLine.find_first_not_of(" \t") && !isAfterStatementEnd(sPrecedingCode);
+
+        // Skip headers of control statements without braces like `if (...)`, `else` or `for (...)`.
+        const auto startsWithKeywordAt = [&](size_t iPos, std::string_view sKeyword) {
+            return std::string_view(sGlslLine).substr(iPos).starts_with(sKeyword) &&
+                   (iPos + sKeyword.size() == sGlslLine.size() ||
+                    !isIdentifierCharacter(sGlslLine[iPos + sKeyword.size()]));
+        };
+        auto iBodyStartPos = iStatementStartPos;
+        while (true) {
+            const auto pKeyword =
+                std::ranges::find_if(vControlStatementKeywords, [&](std::string_view sKeyword) {
+                    return startsWithKeywordAt(iBodyStartPos, sKeyword);
+                });
+            if (pKeyword == vControlStatementKeywords.end()) {
+                break;
+            }
+            auto iHeaderEndPos = iBodyStartPos + pKeyword->size();
+            if (*pKeyword != "else" && *pKeyword != "do") {
+                const auto iConditionPos = sGlslLine.find_first_not_of(" \t", iHeaderEndPos);
+                if (iConditionPos == std::string::npos || sGlslLine[iConditionPos] != '(') {
+                    break;
+                }
+                const auto iConditionEndPos = findClosingParenthesis(sGlslLine, iConditionPos + 1);
+                if (iConditionEndPos == std::string::npos || iConditionEndPos > iCallPos) {
+                    // The call is in the condition, it can be moved before the statement only if it's
+                    // the condition of an `if` that is always evaluated.
+                    if (*pKeyword != "if" || bIsInConditionalBody) [[unlikely]] {
+                        return makeError(std::format(
+                            "it's used in a condition of `{}` that can't be evaluated before the statement, "
+                            "store the result in a variable before the statement",
+                            *pKeyword));
+                    }
+                    break;
                 }
+                iHeaderEndPos = iConditionEndPos + 1;
+            }
+            bIsInConditionalBody = true;
+            iBodyStartPos = sGlslLine.find_first_not_of(" \t", iHeaderEndPos);
+        }
+        if (bIsInConditionalBody) {
+            // Only the body is the statement that can be modified.
+            iStatementStartPos = iBodyStartPos;
+        }
+        const auto makeBodyError = [&]() {
+            return makeError(
+                "it's used in a body of `if`, `else`, `for`, `while` or `do` without braces, "
+                "add braces around the body");
+        };
 
-                // Remember this position.
-                iBindingIndexPositionToReplace = iCurrentPos;
+        const auto sBefore =
+            trim(std::string_view(sGlslLine).substr(iStatementStartPos, iCallPos - iStatementStartPos));
+        const auto iStatementEndPos = sGlslLine.find(';', iClosePos);
+        const auto bIsCallLastInStatement =
+            iStatementEndPos != std::string::npos &&
+            trim(std::string_view(sGlslLine).substr(iClosePos + 1, iStatementEndPos - iClosePos - 1)).empty();
+
+        if (sBefore.find("&&") != std::string::npos || sBefore.find("||") != std::string::npos ||
+            sBefore.find('?') != std::string::npos) [[unlikely]] {
+            // Moving the call before the statement would execute it even if the operand is not evaluated.
+            return makeError(
+                "it's used in a conditionally evaluated operand of `&&`, `||` or `?:`, store the result "
+                "in a variable before the expression");
+        }
+
+        if (sBefore.empty() && bIsCallLastInStatement) {
+            // The original value is not used.
+            if (!pAtomic->sHlslNameWithoutResult.empty()) {
+                sGlslLine.replace(iCallPos, iStatementEndPos + 1 - iCallPos, makeCall(""));
+                continue;
+            }
+        } else if (sBefore.ends_with('=') && bIsCallLastInStatement) {
+            // Maybe a simple assignment (not `==` or `+=` for example) like `x = ` or `uint x = `.
+            const auto sAssignedTo = trim(std::string_view(sBefore).substr(0, sBefore.size() - 1));
+            const auto iNamePos = sAssignedTo.find_last_of(" \t");
+            const auto bIsSimpleAssignment =
+                sBefore.size() >= 2 &&
+                std::string_view("=!<>+-*/%&|^").find(sBefore[sBefore.size() - 2]) == std::string_view::npos;
+            if (bIsSimpleAssignment && sAssignedTo.find_first_of("=?(") == std::string::npos) {
+                // Write the original value directly to the variable.
+                std::string sStatement;
+                if (iNamePos == std::string::npos) {
+                    sStatement = makeCall(sAssignedTo);
+                } else if (bIsInConditionalBody) [[unlikely]] {
+                    return makeBodyError();
+                } else {
+                    const auto sName = sAssignedTo.substr(iNamePos + 1);
+                    sStatement = std::format("{}; {}", sAssignedTo, makeCall(sName));
+                }
+                sGlslLine.replace(iStatementStartPos, iStatementEndPos + 1 - iStatementStartPos, sStatement);
+                continue;
+            }
+        }
+
+        // Get the original value into a temporary right before the statement.
+        if (bIsInConditionalBody) [[unlikely]] {
+            // The call would be moved out of the body and executed unconditionally.
+            return makeBodyError();
+        }
+        const auto sTemporary = std::format("{}{}", sAtomicOriginalValuePrefix, iGeneratedNameCount);
+        iGeneratedNameCount += 1;
+        auto optionalTemporaryType =
+            findAtomicValueType(vArguments[0], std::string_view(sGlslLine).substr(0, iCallPos));
+        if (!optionalTemporaryType.has_value()) {
+            optionalTemporaryType = findAtomicValueType(vArguments[0], sPrecedingCode);
+        }
+        const auto sTemporaryType = optionalTemporaryType.value_or("uint");
+        if (sBefore.empty() && bIsCallLastInStatement) {
+            sGlslLine.replace(
+                iCallPos,
+                iStatementEndPos + 1 - iCallPos,
+                std::format("{} {}; {}", sTemporaryType, sTemporary, makeCall(sTemporary)));
+            continue;
+        }
+        sGlslLine.replace(iCallPos, iClosePos + 1 - iCallPos, sTemporary);
+        sGlslLine.insert(
+            iStatementStartPos,
+            std::format("{} {}; {} ", sTemporaryType, sTemporary, makeCall(sTemporary)));
+    }
+}
+
+void CombinedShaderLanguageParser::convertHlslAtomicsToGlsl(std::string& sHlslLine) {
+    for (const auto& atomic : vAtomicFunctions) {
+        for (const auto sHlslName : std::array{atomic.sHlslName, atomic.sHlslNameWithoutResult}) {
+            if (sHlslName.empty()) {
+                continue;
+            }
+
+            size_t iCallPos = 0;
+            while ((iCallPos = findFunctionCall(sHlslLine, sHlslName, iCallPos)) != std::string::npos) {
+                const auto iCommentStartPos = sHlslLine.find("//");
+                if (iCommentStartPos != std::string::npos && iCommentStartPos < iCallPos) {
+                    break;
+                }
+
+                const auto iArgumentsPos = iCallPos + sHlslName.size();
+                const auto iClosePos = findClosingParenthesis(sHlslLine, iArgumentsPos);
+                if (iClosePos == std::string::npos) {
+                    break;
+                }
+                auto vArguments = splitFunctionArguments(
+                    std::string_view(sHlslLine).substr(iArgumentsPos, iClosePos - iArgumentsPos));
+
+                // The original value (if specified) is the last argument.
+                std::string sOriginalValue;
+                if (vArguments.size() == atomic.iGlslArgumentCount + 1) {
+                    sOriginalValue = std::move(vArguments.back());
+                    vArguments.pop_back();
+                } else if (vArguments.size() != atomic.iGlslArgumentCount) {
+                    iCallPos += 1;
+                    continue;
+                }
+
+                std::string sCall(atomic.sGlslName);
+                for (size_t i = 0; i < vArguments.size(); i++) {
+                    sCall += (i == 0 ? "" : ", ") + vArguments[i];
+                }
+                sCall += ")";
+                if (!sOriginalValue.empty()) {
+                    sCall = std::format("{} = {}", sOriginalValue, sCall);
+                }
+
+                sHlslLine.replace(iCallPos, iClosePos + 1 - iCallPos, sCall);
+                iCallPos += sCall.size();
+            }
+        }
+    }
+}
+
+std::optional<std::string> CombinedShaderLanguageParser::convertWorkgroupSize(
+    bool bParseAsHlsl,
+    std::string& sLine,
+    const std::unordered_map<std::string, unsigned int>& workgroupSize,
+    std::string& sPendingNumThreads) {
+    // Values in the order of `numthreads` arguments (not specified GLSL qualifiers are empty).
+    std::array<std::optional<std::string>, vGlslWorkgroupSizeQualifiers.size()> vValues;
+    bool bIsHlslDeclaration = false;
+    size_t iDeclarationStartPos = 0;
+    size_t iDeclarationEndPos = 0;
+
+    const auto iCommentStartPos = sLine.find("//");
+    const auto iNumThreadsPos = sLine.find(sHlslNumThreadsKeyword);
+    if (iNumThreadsPos != std::string::npos) {
+        if (iCommentStartPos < iNumThreadsPos) {
+            return {};
+        }
+
+        // Read `numthreads` arguments.
+        const auto iArgumentsPos = iNumThreadsPos + sHlslNumThreadsKeyword.size();
+        const auto iClosePos = findClosingParenthesis(sLine, iArgumentsPos);
+        if (iClosePos == std::string::npos || iClosePos + 1 >= sLine.size() || sLine[iClosePos + 1] != ']')
+            [[unlikely]] {
+            return std::format("expected to find `)]` after `{}`", sHlslNumThreadsKeyword);
+        }
+        const auto vArguments =
+            splitFunctionArguments(std::string_view(sLine).substr(iArgumentsPos, iClosePos - iArgumentsPos));
+        if (vArguments.size() != vValues.size()) [[unlikely]] {
+            return std::format(
+                "expected {} arguments in `{}` but found {}",
+                vValues.size(),
+                sHlslNumThreadsKeyword,
+                vArguments.size());
+        }
+        for (size_t i = 0; i < vArguments.size(); i++) {
+            vValues[i] = vArguments[i];
+        }
+
+        bIsHlslDeclaration = true;
+        iDeclarationStartPos = iNumThreadsPos;
+        iDeclarationEndPos = iClosePos + 2;
+    } else {
+        const auto iLayoutPos = sLine.find(sGlslLayoutKeyword);
+        if (iLayoutPos == std::string::npos || iCommentStartPos < iLayoutPos) {
+            return {};
+        }
+
+        // Make sure this is an input declaration `layout(...) in;`.
+        const auto iQualifiersPos = iLayoutPos + sGlslLayoutKeyword.size();
+        const auto iClosePos = findClosingParenthesis(sLine, iQualifiersPos);
+        if (iClosePos == std::string::npos) {
+            return {};
+        }
+        const auto iInPos = sLine.find_first_not_of(" \t", iClosePos + 1);
+        if (iInPos == std::string::npos || sLine.compare(iInPos, 2, "in") != 0) {
+            return {};
+        }
+        const auto iSemicolonPos = sLine.find_first_not_of(" \t", iInPos + 2);
+        if (iSemicolonPos == std::string::npos || sLine[iSemicolonPos] != ';') {
+            return {};
+        }
+
+        // Read qualifiers.
+        const auto sQualifiers = std::string_view(sLine).substr(iQualifiersPos, iClosePos - iQualifiersPos);
+        const auto vQualifiers = splitFunctionArguments(sQualifiers);
+        for (const auto& sQualifier : vQualifiers) {
+            const auto iEqualPos = sQualifier.find('=');
+            const auto sName = std::string_view(sQualifier).substr(0, sQualifier.find_first_of(" \t="));
+            const auto it = std::ranges::find(vGlslWorkgroupSizeQualifiers, sName);
+            if (it == vGlslWorkgroupSizeQualifiers.end()) {
+                // Not a workgroup size declaration (or uses specialization constants like `local_size_x_id`).
+                return {};
+            }
+            const auto iValuePos = iEqualPos == std::string::npos
+                                       ? std::string::npos
+                                       : sQualifier.find_first_not_of(" \t", iEqualPos + 1);
+            if (iValuePos == std::string::npos) [[unlikely]] {
+                return std::format("expected to find a value of `{}`", sName);
+            }
+            const auto iValueIndex = static_cast<size_t>(it - vGlslWorkgroupSizeQualifiers.begin());
+            vValues[iValueIndex] = sQualifier.substr(iValuePos);
+        }
+
+        iDeclarationStartPos = iLayoutPos;
+        iDeclarationEndPos = iSemicolonPos + 1;
+    }
+
+    // Replace `?` with specified values.
+    bool bReplacedValue = false;
+    for (size_t i = 0; i < vValues.size(); i++) {
+        if (vValues[i] != "?") {
+            continue;
+        }
+        const auto it = workgroupSize.find(std::string(vGlslWorkgroupSizeQualifiers[i]));
+        if (it == workgroupSize.end()) [[unlikely]] {
+            return std::format(
+                "found `?` in workgroup size but the value of `{}` was not specified in parse options",
+                vGlslWorkgroupSizeQualifiers[i]);
+        }
+        vValues[i] = std::to_string(it->second);
+        bReplacedValue = true;
+    }
+    if (bIsHlslDeclaration == bParseAsHlsl && !bReplacedValue) {
+        // Nothing to change.
+        return {};
+    }
 
+    // Write the declaration in the resulting language.
+    std::string sDeclaration;
+    if (bParseAsHlsl) {
+        sDeclaration = std::format(
+            "{}{}, {}, {})]",
+            sHlslNumThreadsKeyword,
+            vValues[0].value_or("1"),
+            vValues[1].value_or("1"),
+            vValues[2].value_or("1"));
+    } else {
+        std::string sQualifiers;
+        for (size_t i = 0; i < vValues.size(); i++) {
+            if (!vValues[i].has_value()) {
+                continue;
+            }
+            if (!sQualifiers.empty()) {
+                sQualifiers += ", ";
+            }
+            sQualifiers += std::format("{} = {}", vGlslWorkgroupSizeQualifiers[i], vValues[i].value());
+        }
+        sDeclaration = std::format("{}{}) in;", sGlslLayoutKeyword, sQualifiers);
+    }
+
+    if (bParseAsHlsl && !bIsHlslDeclaration) {
+        // The attribute will be placed right before the entry function.
+        if (!sPendingNumThreads.empty()) [[unlikely]] {
+            return "found multiple workgroup size declarations before the `main` function";
+        }
+        sPendingNumThreads = std::move(sDeclaration);
+        auto iRemainderPos = sLine.find_first_not_of(" \t", iDeclarationEndPos);
+        iRemainderPos = iRemainderPos == std::string::npos ? sLine.size() : iRemainderPos;
+        sLine.erase(iDeclarationStartPos, iRemainderPos - iDeclarationStartPos);
+        return {};
+    }
+    sLine.replace(iDeclarationStartPos, iDeclarationEndPos - iDeclarationStartPos, sDeclaration);
+
+    return {};
+}
+
+std::optional<std::string> CombinedShaderLanguageParser::convertSpecializationConstant(
+    bool bParseAsHlsl, std::string& sLine, const std::unordered_map<unsigned int, std::string>& values) {
+    size_t iAttributeStartPos = 0;
+    size_t iIdPos = 0;
+    size_t iDeclarationStartPos = 0;
+
+    const auto iCommentStartPos = sLine.find("//");
+    const auto iHlslAttributePos = sLine.find(sHlslConstantIdKeyword);
+    if (iHlslAttributePos != std::string::npos) {
+        if (iCommentStartPos < iHlslAttributePos) {
+            return {};
+        }
+
+        // Find the end of the attribute.
+        iIdPos = sLine.find_first_not_of(" \t", iHlslAttributePos + sHlslConstantIdKeyword.size());
+        const auto iAttributeEndPos = sLine.find(")]]", iHlslAttributePos);
+        if (iAttributeEndPos == std::string::npos) [[unlikely]] {
+            return std::format("expected to find `)]]` after `{}`", sHlslConstantIdKeyword);
+        }
+        iAttributeStartPos = iHlslAttributePos;
+        iDeclarationStartPos = iAttributeEndPos + 3;
+    } else {
+        const auto iLayoutPos = sLine.find(sGlslLayoutKeyword);
+        if (iLayoutPos == std::string::npos || iCommentStartPos < iLayoutPos) {
+            return {};
+        }
+
+        // Make sure `constant_id` is the only qualifier.
+        const auto iQualifierPos = sLine.find_first_not_of(" \t", iLayoutPos + sGlslLayoutKeyword.size());
+        if (iQualifierPos == std::string::npos ||
+            sLine.compare(iQualifierPos, sGlslConstantIdKeyword.size(), sGlslConstantIdKeyword) != 0) {
+            return {};
+        }
+        const auto iEqualPos =
+            sLine.find_first_not_of(" \t", iQualifierPos + sGlslConstantIdKeyword.size());
+        const auto iClosePos = sLine.find(')', iQualifierPos);
+        if (iEqualPos == std::string::npos || sLine[iEqualPos] != '=' || iClosePos == std::string::npos)
+            [[unlikely]] {
+            return std::format("expected to find `{} = N)`", sGlslConstantIdKeyword);
+        }
+        iIdPos = sLine.find_first_not_of(" \t", iEqualPos + 1);
+        iAttributeStartPos = iLayoutPos;
+        iDeclarationStartPos = iClosePos + 1;
+    }
+
+    // Read constant ID.
+    if (iIdPos == std::string::npos) [[unlikely]] {
+        return "expected to find specialization constant ID";
+    }
+    auto idResult = readNumberFromString(sLine, iIdPos);
+    if (std::holds_alternative<std::string>(idResult)) [[unlikely]] {
+        return std::format(
+            "failed to read specialization constant ID, error: {}", std::get<std::string>(idResult));
+    }
+    const auto iConstantId = std::get<unsigned int>(idResult);
+
+    // Make sure a constant is declared.
+    iDeclarationStartPos = sLine.find_first_not_of(" \t", iDeclarationStartPos);
+    if (iDeclarationStartPos == std::string::npos ||
+        !std::string_view(sLine).substr(iDeclarationStartPos).starts_with("const ")) [[unlikely]] {
+        return std::format("expected to find a constant declaration after constant ID {}", iConstantId);
+    }
+
+    const auto it = values.find(iConstantId);
+    if (it == values.end()) {
+        // Convert the attribute.
+        const auto bIsHlslAttribute = iHlslAttributePos != std::string::npos;
+        if (bIsHlslAttribute == bParseAsHlsl) {
+            return {};
+        }
+        auto sAttribute = std::format("{}{})]] ", sHlslConstantIdKeyword, iConstantId);
+        if (!bParseAsHlsl) {
+            sAttribute = std::format("{}{} = {}) ", sGlslLayoutKeyword, sGlslConstantIdKeyword, iConstantId);
+        }
+        sLine.replace(iAttributeStartPos, iDeclarationStartPos - iAttributeStartPos, sAttribute);
+        return {};
+    }
+
+    // Fold into a regular constant with the specified value.
+    const auto iAssignPos = sLine.find('=', iDeclarationStartPos);
+    const auto iSemicolonPos = sLine.find(';', iDeclarationStartPos);
+    if (iAssignPos == std::string::npos || iSemicolonPos == std::string::npos || iSemicolonPos < iAssignPos)
+        [[unlikely]] {
+        return std::format("expected specialization constant {} to have a default value", iConstantId);
+    }
+    sLine.replace(iAssignPos + 1, iSemicolonPos - iAssignPos - 1, std::format(" {}", it->second));
+    sLine.replace(
+        iAttributeStartPos, iDeclarationStartPos - iAttributeStartPos, bParseAsHlsl ? "static " : "");
+
+    return {};
+}
+
+void CombinedShaderLanguageParser::convertControlFlowAttributes(bool bParseAsHlsl, std::string& sLine) {
+    // Prepare a lambda to check that the attribute is applied to a statement.
+    const auto isAppliedToStatement = [&](size_t iAttributeStartPos, size_t iAttributeEndPos) {
+        if (iAttributeStartPos > 0 && sLine[iAttributeStartPos - 1] == '[') {
+            // Part of a GLSL attribute.
+            return false;
+        }
+        const auto iNextPos = sLine.find_first_not_of(" \t", iAttributeEndPos);
+        if (iNextPos == std::string::npos) {
+            return true;
+        }
+        const auto sNext = std::string_view(sLine).substr(iNextPos);
+        if (sNext.starts_with("//") || sNext.starts_with('[')) {
+            return true;
+        }
+        constexpr std::array<std::string_view, 5> vStatementKeywords = {"for", "while", "do", "if", "switch"};
+        return std::ranges::any_of(vStatementKeywords, [&](std::string_view sKeyword) {
+            return sNext.starts_with(sKeyword) &&
+                   (sNext.size() == sKeyword.size() ||
+                    (std::isalnum(static_cast<unsigned char>(sNext[sKeyword.size()])) == 0 &&
+                     sNext[sKeyword.size()] != '_'));
+        });
+    };
+
+    // HLSL unroll with the number of iterations (GLSL `[[unroll]]` does not have it).
+    const auto sGlslUnroll = vControlFlowAttributes[0].sGlslName;
+    size_t iCurrentPos = 0;
+    while (!bParseAsHlsl &&
+           (iCurrentPos = sLine.find(sHlslUnrollCountKeyword, iCurrentPos)) != std::string::npos) {
+        const auto iAttributeEndPos = sLine.find(")]", iCurrentPos);
+        if (iAttributeEndPos == std::string::npos ||
+            !isAppliedToStatement(iCurrentPos, iAttributeEndPos + 2)) {
+            iCurrentPos += 1;
+            continue;
+        }
+        sLine.replace(iCurrentPos, iAttributeEndPos + 2 - iCurrentPos, sGlslUnroll);
+        iCurrentPos += sGlslUnroll.size();
+    }
+
+    for (const auto& attribute : vControlFlowAttributes) {
+        const auto sReplaceFrom = bParseAsHlsl ? attribute.sGlslName : attribute.sHlslName;
+        const auto sReplaceTo = bParseAsHlsl ? attribute.sHlslName : attribute.sGlslName;
+
+        iCurrentPos = 0;
+        while ((iCurrentPos = sLine.find(sReplaceFrom, iCurrentPos)) != std::string::npos) {
+            if (!isAppliedToStatement(iCurrentPos, iCurrentPos + sReplaceFrom.size())) {
+                iCurrentPos += 1;
+                continue;
+            }
+            sLine.replace(iCurrentPos, sReplaceFrom.size(), sReplaceTo);
+            iCurrentPos += sReplaceTo.size();
+        }
+    }
+}
+
+std::unordered_map<std::string, const CombinedShaderLanguageParser::TextureType*>
+CombinedShaderLanguageParser::findTextureDeclarations(bool bParseAsHlsl, const std::string& sFullSourceCode) {
+    const auto isIdentifierChar = [](char character) {
+        return std::isalnum(static_cast<unsigned char>(character)) != 0 || character == '_';
+    };
+
+    std::unordered_map<std::string, const TextureType*> textures;
+    for (const auto& type : vTextureTypes) {
+        const auto sTypeName = bParseAsHlsl ? type.sHlslName : type.sGlslName;
+        for (auto iPos = sFullSourceCode.find(sTypeName); iPos != std::string::npos;
+             iPos = sFullSourceCode.find(sTypeName, iPos + 1)) {
+            // Make sure this is not a part of some other name (GLSL integer samplers use `i`/`u` prefixes).
+            auto iTypeStartPos = iPos;
+            if (!bParseAsHlsl && iTypeStartPos > 0 &&
+                (sFullSourceCode[iTypeStartPos - 1] == 'i' || sFullSourceCode[iTypeStartPos - 1] == 'u')) {
+                iTypeStartPos -= 1;
+            }
+            if (iTypeStartPos > 0 && isIdentifierChar(sFullSourceCode[iTypeStartPos - 1])) {
+                continue;
+            }
+            auto iNamePos = iPos + sTypeName.size();
+            if (iNamePos < sFullSourceCode.size() && sFullSourceCode[iNamePos] == '<') {
+                // Skip HLSL template argument.
+                iNamePos = sFullSourceCode.find('>', iNamePos);
+                if (iNamePos == std::string::npos) {
+                    continue;
+                }
+                iNamePos += 1;
+            }
+            if (iNamePos < sFullSourceCode.size() && isIdentifierChar(sFullSourceCode[iNamePos])) {
+                // Some other type (for example `sampler2DArray` when looking for `sampler2D`).
+                continue;
+            }
+
+            // Read name.
+            iNamePos = sFullSourceCode.find_first_not_of(" \t", iNamePos);
+            auto iNameEndPos = iNamePos;
+            while (iNameEndPos < sFullSourceCode.size() && isIdentifierChar(sFullSourceCode[iNameEndPos])) {
+                iNameEndPos += 1;
+            }
+            if (iNamePos == iNameEndPos) {
+                continue;
+            }
+            textures[sFullSourceCode.substr(iNamePos, iNameEndPos - iNamePos)] = &type;
+        }
+    }
+
+    return textures;
+}
+
+std::optional<std::string>
+CombinedShaderLanguageParser::convertGlslTextureFunctionsToHlsl(std::string& sFullSourceCode) {
+    const auto textures = findTextureDeclarations(true, sFullSourceCode);
+    if (textures.empty()) {
+        return {};
+    }
+
+    const auto isInComment = [&](size_t iPos) {
+        const auto iLineStartPos = sFullSourceCode.rfind('\n', iPos);
+        return sFullSourceCode.find("//", iLineStartPos == std::string::npos ? 0 : iLineStartPos) < iPos;
+    };
+
+    // Prepare a lambda to replace calls of a GLSL function with HLSL method calls.
+    std::optional<std::string> optionalError;
+    const auto replaceCalls = [&](std::string_view sGlslName, const auto& makeMethodCall) {
+        size_t iCallPos = 0;
+        while ((iCallPos = findFunctionCall(sFullSourceCode, sGlslName, iCallPos)) != std::string::npos) {
+            const auto iArgumentsPos = iCallPos + sGlslName.size();
+            const auto iClosePos = findClosingParenthesis(sFullSourceCode, iArgumentsPos);
+            if (iClosePos == std::string::npos) {
+                return;
+            }
+            const auto vArguments = splitFunctionArguments(
+                std::string_view(sFullSourceCode).substr(iArgumentsPos, iClosePos - iArgumentsPos));
+
+            // Make sure the texture is declared.
+            std::optional<std::string> optionalMethodCall;
+            if (!vArguments.empty() && !isInComment(iCallPos)) {
+                const auto it = textures.find(vArguments[0].substr(0, vArguments[0].find('[')));
+                if (it != textures.end()) {
+                    optionalMethodCall = makeMethodCall(vArguments, *it->second);
+                }
+            }
+            if (optionalError.has_value()) [[unlikely]] {
+                optionalError = std::format(
+                    "unable to convert \"{}\" because {}",
+                    sFullSourceCode.substr(iCallPos, iClosePos + 1 - iCallPos),
+                    optionalError.value());
+                return;
+            }
+            if (!optionalMethodCall.has_value()) {
+                iCallPos = iArgumentsPos;
+                continue;
+            }
+
+            sFullSourceCode.replace(iCallPos, iClosePos + 1 - iCallPos, optionalMethodCall.value());
+            iCallPos += optionalMethodCall->size();
+        }
+    };
+
+    // Texel loads.
+    replaceCalls(
+        "texelFetch(",
+        [](const std::vector<std::string>& vArguments,
+           const TextureType& type) -> std::optional<std::string> {
+            if (vArguments.size() != 3 || type.iCoordinateCount == 0) {
+                return {};
+            }
+            if (type.bIsMultisampled) {
+                return std::format("{}.Load({}, {})", vArguments[0], vArguments[1], vArguments[2]);
+            }
+            return std::format(
+                "{}.Load(int{}({}, {}))",
+                vArguments[0],
+                type.iCoordinateCount + 1,
+                vArguments[1],
+                vArguments[2]);
+        });
+
+    // Find a sampler for functions that need it.
+    std::string sSamplerName;
+    size_t iSamplerCount = 0;
+    constexpr std::string_view sSamplerKeyword = "SamplerState ";
+    for (auto iPos = findFunctionCall(sFullSourceCode, sSamplerKeyword, 0); iPos != std::string::npos;
+         iPos = findFunctionCall(sFullSourceCode, sSamplerKeyword, iPos + 1)) {
+        const auto iNamePos = sFullSourceCode.find_first_not_of(" \t", iPos + sSamplerKeyword.size());
+        const auto iNameEndPos = sFullSourceCode.find_first_of(" \t:;[", iNamePos);
+        if (iNamePos == std::string::npos || iNameEndPos == std::string::npos) {
+            continue;
+        }
+        sSamplerName = sFullSourceCode.substr(iNamePos, iNameEndPos - iNamePos);
+        iSamplerCount += 1;
+    }
+    const auto isSamplerKnown = [&]() {
+        if (iSamplerCount != 1) [[unlikely]] {
+            // Not clear which sampler to use.
+            optionalError =
+                std::format("{} `SamplerState`s are declared (expected exactly one to use)", iSamplerCount);
+            return false;
+        }
+        return true;
+    };
+
+    // Gathers.
+    replaceCalls(
+        "textureGather(",
+        [&](const std::vector<std::string>& vArguments, const TextureType&) -> std::optional<std::string> {
+            size_t iComponent = 0;
+            if (vArguments.size() == 3 && vArguments[2].size() == 1 && vArguments[2][0] >= '0' &&
+                vArguments[2][0] <= '3') {
+                iComponent = static_cast<size_t>(vArguments[2][0] - '0');
+            } else if (vArguments.size() != 2) {
+                return {};
+            }
+            if (!isSamplerKnown()) [[unlikely]] {
                 return {};
+            }
+            return std::format(
+                "{}{}{}, {})", vArguments[0], vHlslGatherMethods[iComponent], sSamplerName, vArguments[1]);
+        });
+    if (optionalError.has_value()) [[unlikely]] {
+        return optionalError;
+    }
+
+    // Sampling.
+    for (const auto& function : vSampleTextureFunctions) {
+        if (&*std::ranges::find(vSampleTextureFunctions, function.sGlslName, &TextureFunction::sGlslName) !=
+            &function) {
+            // Calls of all forms were already converted.
+            continue;
+        }
+        replaceCalls(
+            function.sGlslName,
+            [&](const std::vector<std::string>& vArguments,
+                const TextureType&) -> std::optional<std::string> {
+                // Find the form of the function.
+                const auto pForm =
+                    std::ranges::find_if(vSampleTextureFunctions, [&](const TextureFunction& form) {
+                        return form.sGlslName == function.sGlslName &&
+                               form.iArgumentCount + 1 == vArguments.size();
+                    });
+                if (pForm == vSampleTextureFunctions.end()) [[unlikely]] {
+                    optionalError = "this number of arguments is not supported";
+                    return {};
+                }
+                if (!isSamplerKnown()) [[unlikely]] {
+                    return {};
+                }
+
+                auto vMethodArguments = std::vector<std::string>(vArguments.begin() + 1, vArguments.end());
+                if (pForm->bSwapLastArguments) {
+                    std::swap(vMethodArguments[vMethodArguments.size() - 2], vMethodArguments.back());
+                }
+                auto sMethodCall = std::format("{}{}{}", vArguments[0], pForm->sHlslName, sSamplerName);
+                for (const auto& sArgument : vMethodArguments) {
+                    sMethodCall += std::format(", {}", sArgument);
+                }
+                return sMethodCall + ")";
             });
         if (optionalError.has_value()) [[unlikely]] {
             return optionalError;
         }
+    }
 
-        if (iCurrentPos == std::string::npos) {
-            // Found nothing.
+    return {};
+}
+
+std::optional<std::string>
+CombinedShaderLanguageParser::convertHlslTextureMethodsToGlsl(std::string& sFullSourceCode) {
+    const auto textures = findTextureDeclarations(false, sFullSourceCode);
+    if (textures.empty()) {
+        return {};
+    }
+
+    const auto isIdentifierChar = [](char character) {
+        return std::isalnum(static_cast<unsigned char>(character)) != 0 || character == '_';
+    };
+    const auto isInComment = [&](size_t iPos) {
+        const auto iLineStartPos = sFullSourceCode.rfind('\n', iPos);
+        return sFullSourceCode.find("//", iLineStartPos == std::string::npos ? 0 : iLineStartPos) < iPos;
+    };
+
+    // Prepare a lambda to replace calls of an HLSL method with GLSL function calls.
+    std::optional<std::string> optionalError;
+    const auto replaceMethodCalls = [&](std::string_view sHlslName, const auto& makeFunctionCall) {
+        size_t iMethodPos = 0;
+        while ((iMethodPos = sFullSourceCode.find(sHlslName, iMethodPos)) != std::string::npos) {
+            // Skip array index of the texture (if specified).
+            size_t iNameEndPos = iMethodPos;
+            if (iNameEndPos > 0 && sFullSourceCode[iNameEndPos - 1] == ']') {
+                size_t iDepth = 0;
+                for (size_t i = iMethodPos; i > 0; i--) {
+                    if (sFullSourceCode[i - 1] == ']') {
+                        iDepth += 1;
+                    } else if (sFullSourceCode[i - 1] == '[' && --iDepth == 0) {
+                        iNameEndPos = i - 1;
+                        break;
+                    }
+                }
+            }
+
+            // Read texture name.
+            size_t iTextureStartPos = iNameEndPos;
+            while (iTextureStartPos > 0 && isIdentifierChar(sFullSourceCode[iTextureStartPos - 1])) {
+                iTextureStartPos -= 1;
+            }
+            const auto it =
+                textures.find(sFullSourceCode.substr(iTextureStartPos, iNameEndPos - iTextureStartPos));
+
+            // Read arguments.
+            const auto iArgumentsPos = iMethodPos + sHlslName.size();
+            const auto iClosePos = findClosingParenthesis(sFullSourceCode, iArgumentsPos);
+            if (iClosePos == std::string::npos) {
+                return;
+            }
+
+            std::optional<std::string> optionalFunctionCall;
+            if (it != textures.end() && !isInComment(iMethodPos)) {
+                optionalFunctionCall = makeFunctionCall(
+                    sFullSourceCode.substr(iTextureStartPos, iMethodPos - iTextureStartPos),
+                    splitFunctionArguments(
+                        std::string_view(sFullSourceCode).substr(iArgumentsPos, iClosePos - iArgumentsPos)),
+                    *it->second);
+            }
+            if (optionalError.has_value()) [[unlikely]] {
+                optionalError = std::format(
+                    "unable to convert \"{}\" because {}",
+                    sFullSourceCode.substr(iTextureStartPos, iClosePos + 1 - iTextureStartPos),
+                    optionalError.value());
+                return;
+            }
+            if (!optionalFunctionCall.has_value()) {
+                iMethodPos = iArgumentsPos;
+                continue;
+            }
+
+            sFullSourceCode.replace(
+                iTextureStartPos, iClosePos + 1 - iTextureStartPos, optionalFunctionCall.value());
+            iMethodPos = iTextureStartPos + optionalFunctionCall->size();
+        }
+    };
+
+    // Texel loads.
+    replaceMethodCalls(
+        ".Load(",
+        [&](const std::string& sTexture,
+            const std::vector<std::string>& vArguments,
+            const TextureType& type) -> std::optional<std::string> {
+            if (type.iCoordinateCount == 0) {
+                return {};
+            }
+            if (type.bIsMultisampled) {
+                if (vArguments.size() != 2) {
+                    return {};
+                }
+                return std::format("texelFetch({}, {}, {})", sTexture, vArguments[0], vArguments[1]);
+            }
+            if (vArguments.size() != 1) {
+                return {};
+            }
+
+            // Split location into coordinates and mip level.
+            auto sLocation = vArguments[0];
+            if (!std::ranges::all_of(sLocation, isIdentifierChar)) {
+                sLocation = std::format("({})", sLocation);
+            }
+            constexpr std::string_view sComponents = "xyzw";
+            return std::format(
+                "texelFetch({}, {}.{}, {}.{})",
+                sTexture,
+                sLocation,
+                sComponents.substr(0, type.iCoordinateCount),
+                sLocation,
+                sComponents[type.iCoordinateCount]);
+        });
+
+    // Gathers.
+    for (size_t iComponent = 0; iComponent <= vHlslGatherMethods.size(); iComponent++) {
+        // Plain `Gather` gathers the red component.
+        const auto sMethod =
+            iComponent == vHlslGatherMethods.size() ? ".Gather(" : vHlslGatherMethods[iComponent];
+        replaceMethodCalls(
+            sMethod,
+            [&](const std::string& sTexture,
+                const std::vector<std::string>& vArguments,
+                const TextureType&) -> std::optional<std::string> {
+                if (vArguments.size() != 2) {
+                    return {};
+                }
+                if (iComponent == 0 || iComponent == vHlslGatherMethods.size()) {
+                    return std::format("textureGather({}, {})", sTexture, vArguments[1]);
+                }
+                return std::format("textureGather({}, {}, {})", sTexture, vArguments[1], iComponent);
+            });
+    }
+
+    // Sampling (GLSL uses combined image samplers so the sampler is removed).
+    for (const auto& function : vSampleTextureFunctions) {
+        if (&*std::ranges::find(vSampleTextureFunctions, function.sHlslName, &TextureFunction::sHlslName) !=
+            &function) {
+            // Calls of all forms were already converted.
+            continue;
+        }
+        replaceMethodCalls(
+            function.sHlslName,
+            [&](const std::string& sTexture,
+                const std::vector<std::string>& vArguments,
+                const TextureType&) -> std::optional<std::string> {
+                // Find the form of the method.
+                const auto pForm =
+                    std::ranges::find_if(vSampleTextureFunctions, [&](const TextureFunction& form) {
+                        return form.sHlslName == function.sHlslName &&
+                               form.iArgumentCount + 1 == vArguments.size();
+                    });
+                if (pForm == vSampleTextureFunctions.end()) [[unlikely]] {
+                    optionalError = "this number of arguments is not supported";
+                    return {};
+                }
+
+                auto vFunctionArguments = std::vector<std::string>(vArguments.begin() + 1, vArguments.end());
+                if (pForm->bSwapLastArguments) {
+                    std::swap(vFunctionArguments[vFunctionArguments.size() - 2], vFunctionArguments.back());
+                }
+                auto sFunctionCall = std::format("{}{}", pForm->sGlslName, sTexture);
+                for (const auto& sArgument : vFunctionArguments) {
+                    sFunctionCall += std::format(", {}", sArgument);
+                }
+                return sFunctionCall + ")";
+            });
+        if (optionalError.has_value()) [[unlikely]] {
+            return optionalError;
+        }
+    }
+
+    return {};
+}
+
+void CombinedShaderLanguageParser::addRequiredGlslExtensions(std::string& sFullSourceCode) {
+    // Collect extensions of used built-ins.
+    std::vector<std::string_view> vRequiredExtensions;
+    const auto addIfUsed = [&](const SubgroupIntrinsic& intrinsic) {
+        // Look for the name without arguments (also finds calls like `subgroupBallotBitCount(value)`).
+        const auto iArgumentsPos = intrinsic.sGlslName.find('(');
+        const auto sName = intrinsic.sGlslName.substr(
+            0, iArgumentsPos == std::string_view::npos ? iArgumentsPos : iArgumentsPos + 1);
+        if (sFullSourceCode.find(sName) != std::string::npos &&
+            std::ranges::find(vRequiredExtensions, intrinsic.sGlslExtension) == vRequiredExtensions.end()) {
+            vRequiredExtensions.push_back(intrinsic.sGlslExtension);
+        }
+    };
+    std::ranges::for_each(vSubgroupIntrinsics, addIfUsed);
+    std::ranges::for_each(vComposedSubgroupIntrinsics, addIfUsed);
+
+    // All subgroup extensions are based on the basic one.
+    constexpr std::string_view sSubgroupBasicExtension = "GL_KHR_shader_subgroup_basic";
+    if (!vRequiredExtensions.empty() &&
+        std::ranges::find(vRequiredExtensions, sSubgroupBasicExtension) == vRequiredExtensions.end()) {
+        vRequiredExtensions.insert(vRequiredExtensions.begin(), sSubgroupBasicExtension);
+    }
+
+    // Check 16 bit float types.
+    const auto isTypeUsed = [&](std::string_view sType) {
+        return sFullSourceCode.find(sType) != std::string::npos;
+    };
+    if (isTypeUsed("float16_t") || isTypeUsed("f16vec") || isTypeUsed("f16mat")) {
+        vRequiredExtensions.push_back(sGlslFloat16Extension);
+    }
+
+    // Check control flow attributes.
+    if (std::ranges::any_of(vControlFlowAttributes, [&](const ControlFlowAttribute& attribute) {
+            return sFullSourceCode.find(attribute.sGlslName) != std::string::npos;
+        })) {
+        vRequiredExtensions.push_back(sGlslControlFlowExtension);
+    }
+
+    if (vRequiredExtensions.empty()) {
+        return;
+    }
+
+    // Skip extensions that are already enabled.
+    std::string sDirectives;
+    for (const auto& sExtension : vRequiredExtensions) {
+        if (sFullSourceCode.find(std::format("#extension {}", sExtension)) == std::string::npos) {
+            sDirectives += std::format("#extension {} : require\n", sExtension);
+        }
+    }
+
+    // Directives must be placed after `#version`.
+    size_t iInsertPos = 0;
+    const auto iVersionPos = sFullSourceCode.find("#version");
+    if (iVersionPos != std::string::npos) {
+        iInsertPos = sFullSourceCode.find('\n', iVersionPos);
+        iInsertPos = iInsertPos == std::string::npos ? sFullSourceCode.size() : iInsertPos + 1;
+    }
+    sFullSourceCode.insert(iInsertPos, sDirectives);
+}
+
+void CombinedShaderLanguageParser::addHelperFunctions(bool bParseAsHlsl, std::string& sFullSourceCode) {
+    // Checks that the name is not a part of some other name (`packHalf2x16(` in `unpackHalf2x16(`).
+    const auto isCalled = [&](std::string_view sName) {
+        for (auto iPos = sFullSourceCode.find(sName); iPos != std::string::npos;
+             iPos = sFullSourceCode.find(sName, iPos + 1)) {
+            if (iPos == 0 || (std::isalnum(static_cast<unsigned char>(sFullSourceCode[iPos - 1])) == 0 &&
+                              sFullSourceCode[iPos - 1] != '_')) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    std::string sHelperFunctions;
+    for (const auto& helper : bParseAsHlsl ? std::span<const HelperFunction>(vHlslHelperFunctions)
+                                           : std::span<const HelperFunction>(vGlslHelperFunctions)) {
+        // Skip if already defined (for example in a language-specific block).
+        const auto sSignature = helper.sDefinition.substr(0, helper.sDefinition.find(')') + 1);
+        if (!isCalled(helper.sName) || sFullSourceCode.find(sSignature) != std::string::npos) {
+            continue;
+        }
+        sHelperFunctions += helper.sDefinition;
+    }
+    if (sHelperFunctions.empty()) {
+        return;
+    }
+
+    size_t iInsertPos = 0;
+    if (!bParseAsHlsl) {
+        // Place after directives that must come first.
+        for (const auto& sDirective : {"#version", "#extension"}) {
+            const auto iDirectivePos = sFullSourceCode.rfind(sDirective);
+            if (iDirectivePos == std::string::npos) {
+                continue;
+            }
+            const auto iLineEndPos = sFullSourceCode.find('\n', iDirectivePos);
+            iInsertPos = std::max(
+                iInsertPos, iLineEndPos == std::string::npos ? sFullSourceCode.size() : iLineEndPos + 1);
+        }
+    }
+    sFullSourceCode.insert(iInsertPos, sHelperFunctions);
+}
+
+bool CombinedShaderLanguageParser::BindingIndexSet::isUsed(unsigned int iIndex) const {
+    const auto iWordIndex = iIndex / iBitsPerWord;
+    if (iWordIndex >= vUsedIndexBits.size()) {
+        return false;
+    }
+
+    return (vUsedIndexBits[iWordIndex] & (uint64_t{1} << (iIndex % iBitsPerWord))) != 0;
+}
+
+bool CombinedShaderLanguageParser::BindingIndexSet::markUsed(unsigned int iIndex) {
+    const auto iWordIndex = iIndex / iBitsPerWord;
+    if (iWordIndex >= vUsedIndexBits.size()) {
+        vUsedIndexBits.resize(iWordIndex + 1, 0);
+    }
+
+    const auto iBit = uint64_t{1} << (iIndex % iBitsPerWord);
+    if ((vUsedIndexBits[iWordIndex] & iBit) != 0) {
+        return false;
+    }
+    vUsedIndexBits[iWordIndex] |= iBit;
+
+    return true;
+}
+
+unsigned int CombinedShaderLanguageParser::BindingIndexSet::findFreeIndex(unsigned int iStartIndex) const {
+    auto iIndex = iStartIndex;
+
+    // Check the first word bit by bit.
+    while (iIndex % iBitsPerWord != 0) {
+        if (!isUsed(iIndex)) {
+            return iIndex;
+        }
+        iIndex += 1;
+    }
+
+    // Then skip fully used words.
+    for (auto iWordIndex = iIndex / iBitsPerWord; iWordIndex < vUsedIndexBits.size(); iWordIndex++) {
+        const auto iWord = vUsedIndexBits[iWordIndex];
+        if (iWord != ~uint64_t{0}) {
+            return static_cast<unsigned int>(iWordIndex * iBitsPerWord + std::countr_one(iWord));
+        }
+    }
+
+    return std::max(iIndex, static_cast<unsigned int>(vUsedIndexBits.size() * iBitsPerWord));
+}
+
+CombinedShaderLanguageParser::BindingIndexSet*
+CombinedShaderLanguageParser::HlslRegisterIndices::getUsedIndices(char registerType, unsigned int iSpace) {
+    const auto it = std::ranges::find(vRegisterTypes, registerType);
+    if (it == vRegisterTypes.end()) {
+        return nullptr;
+    }
+
+    auto& vSpaces = vUsedIndicesPerSpace[static_cast<size_t>(it - vRegisterTypes.begin())];
+    if (iSpace >= vSpaces.size()) {
+        vSpaces.resize(static_cast<size_t>(iSpace) + 1);
+    }
+
+    return &vSpaces[iSpace];
+}
+
+CombinedShaderLanguageParser::BindingIndexSet&
+CombinedShaderLanguageParser::BindingIndicesInfo::getUsedGlslIndices(unsigned int iSet) {
+    if (!bTrackGlslIndicesPerSet) {
+        return usedGlslIndices;
+    }
+
+    if (iSet >= vUsedGlslIndicesPerSet.size()) {
+        vUsedGlslIndicesPerSet.resize(static_cast<size_t>(iSet) + 1);
+    }
+
+    return vUsedGlslIndicesPerSet[iSet];
+}
+
+#if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
+std::optional<std::string> CombinedShaderLanguageParser::assignBindingIndices( // NOLINT: slightly complex
+    bool bParseAsHlsl,
+    std::string& sFullSourceCode,
+    BindingIndicesInfo& bindingIndicesInfo,
+    unsigned int iBaseAutomaticBindingIndex,
+    std::vector<ReflectedBinding>* pReflectedBindings) {
+    if (bParseAsHlsl) {
+        // Prepare some variables.
+        size_t iCurrentPos = 0;
+
+        do {
+            // Prepare some variables.
+            bool bSkipCurrentRegister = false;
+            char registerType = '0';
+            unsigned int iRegisterSpace = 0; // default space if not specified
+            unsigned int iHardcodedRegisterIndex = 0;
+            size_t iRegisterTypePosition = 0;
+            size_t iRegisterIndexPositionToReplace = 0;
+
+            // Find register values.
+            auto optionalError = findHlslRegisterInfo(
+                sFullSourceCode,
+                iCurrentPos,
+                [&]() -> std::optional<std::string> {
+                    // Reached register type.
+                    registerType = sFullSourceCode[iCurrentPos];
+                    iRegisterTypePosition = iCurrentPos;
+
+                    return {};
+                },
+                [&]() -> std::optional<std::string> {
+                    // Reached register index.
+
+                    // Make sure it's our keyword.
+                    if (sFullSourceCode[iCurrentPos] != assignBindingIndexCharacter) {
+                        // Found hardcoded index.
+                        bSkipCurrentRegister = true;
+
+                        if (pReflectedBindings != nullptr) {
+                            auto readResult = readNumberFromString(sFullSourceCode, iCurrentPos);
+                            if (std::holds_alternative<std::string>(readResult)) [[unlikely]] {
+                                return std::get<std::string>(std::move(readResult));
+                            }
+                            iHardcodedRegisterIndex = std::get<unsigned int>(readResult);
+                        }
+
+                        return {};
+                    }
+
+                    // Save this position.
+                    iRegisterIndexPositionToReplace = iCurrentPos;
+
+                    return {};
+                },
+                [&]() -> std::optional<std::string> {
+                    if (bSkipCurrentRegister && pReflectedBindings == nullptr) {
+                        return {};
+                    }
+
+                    if (sFullSourceCode[iCurrentPos] == assignBindingIndexCharacter) [[unlikely]] {
+                        return "`space?` is not supported";
+                    }
+
+                    // Reached register space.
+                    auto readResult = readNumberFromString(sFullSourceCode, iCurrentPos);
+                    if (std::holds_alternative<std::string>(readResult)) [[unlikely]] {
+                        return std::get<std::string>(std::move(readResult));
+                    }
+                    iRegisterSpace = std::get<unsigned int>(readResult);
+
+                    return {};
+                });
+            if (optionalError.has_value()) [[unlikely]] {
+                return optionalError;
+            }
+
+            if (iCurrentPos == std::string::npos) {
+                // Found nothing.
+                return {};
+            }
+
+            if (bSkipCurrentRegister) {
+                if (pReflectedBindings != nullptr) {
+                    ReflectedBinding binding{};
+                    binding.registerType = registerType;
+                    binding.iSpace = iRegisterSpace;
+                    binding.iBindingIndex = iHardcodedRegisterIndex;
+                    readResourceDeclaration(bParseAsHlsl, sFullSourceCode, iRegisterTypePosition, binding);
+                    pReflectedBindings->push_back(std::move(binding));
+                }
+                continue;
+            }
+
+            // Read resource declaration.
+            ReflectedBinding binding{};
+            binding.registerType = registerType;
+            binding.iSpace = iRegisterSpace;
+            binding.bIsAutoAssigned = true;
+            if (pReflectedBindings != nullptr || bindingIndicesInfo.bShareIndicesBetweenSameResources) {
+                readResourceDeclaration(bParseAsHlsl, sFullSourceCode, iRegisterTypePosition, binding);
+            }
+
+            // See if the same resource already has an index (for example in another shader stage).
+            const auto iAlreadyAssignedIndex = findResourceBindingIndex(bindingIndicesInfo, binding);
+            if (iAlreadyAssignedIndex.has_value()) {
+                binding.iBindingIndex = iAlreadyAssignedIndex.value();
+            } else {
+                // Get used indices of this register type and space.
+                auto* pUsedIndices =
+                    bindingIndicesInfo.usedHlslIndices.getUsedIndices(registerType, iRegisterSpace);
+                if (pUsedIndices == nullptr) [[unlikely]] {
+                    return std::format("found unexpected register type `{}`", registerType);
+                }
+
+                // Take the first free index and mark it as used (also for other shader stages).
+                binding.iBindingIndex = pUsedIndices->findFreeIndex(0);
+                pUsedIndices->markUsed(binding.iBindingIndex);
+
+                if (bindingIndicesInfo.bShareIndicesBetweenSameResources && !binding.sResourceName.empty()) {
+                    bindingIndicesInfo.resourceBindingIndices.emplace(
+                        getResourceKey(binding), binding.iBindingIndex);
+                }
+            }
+
+            // Replace our special character with this index.
+            sFullSourceCode.erase(iRegisterIndexPositionToReplace, 1);
+            sFullSourceCode.insert(iRegisterIndexPositionToReplace, std::to_string(binding.iBindingIndex));
+
+            // Update current position (because we might have changed string length).
+            iCurrentPos = iRegisterIndexPositionToReplace;
+
+            if (pReflectedBindings != nullptr) {
+                pReflectedBindings->push_back(std::move(binding));
+            }
+        } while (iCurrentPos < sFullSourceCode.size());
+
+        return {};
+    }
+
+    // Parse as GLSL.
+    size_t iCurrentPos = 0;
+
+    do {
+        size_t iBindingIndexPositionToReplace = 0;
+        unsigned int iHardcodedBindingIndex = 0;
+        bool bSkipThisBinding = false;
+
+        auto optionalError =
+            findGlslBindingIndex(sFullSourceCode, iCurrentPos, [&]() -> std::optional<std::string> {
+                // Make sure this is our special assignment character.
+                if (sFullSourceCode[iCurrentPos] != assignBindingIndexCharacter) {
+                    bSkipThisBinding = true;
+
+                    if (pReflectedBindings != nullptr) {
+                        auto readResult = readNumberFromString(sFullSourceCode, iCurrentPos);
+                        if (std::holds_alternative<std::string>(readResult)) [[unlikely]] {
+                            return std::get<std::string>(std::move(readResult));
+                        }
+                        iHardcodedBindingIndex = std::get<unsigned int>(readResult);
+                        iBindingIndexPositionToReplace = iCurrentPos;
+                    }
+
+                    return {};
+                }
+
+                // Remember this position.
+                iBindingIndexPositionToReplace = iCurrentPos;
+
+                return {};
+            });
+        if (optionalError.has_value()) [[unlikely]] {
+            return optionalError;
+        }
+
+        if (iCurrentPos == std::string::npos) {
+            // Found nothing.
             return {};
         }
 
-        if (bSkipThisBinding) {
+        if (bSkipThisBinding) {
+            if (pReflectedBindings != nullptr) {
+                ReflectedBinding binding{};
+                binding.iSpace = readGlslDescriptorSet(sFullSourceCode, iBindingIndexPositionToReplace);
+                binding.iBindingIndex = iHardcodedBindingIndex;
+                readResourceDeclaration(
+                    bParseAsHlsl, sFullSourceCode, iBindingIndexPositionToReplace, binding);
+                pReflectedBindings->push_back(std::move(binding));
+            }
+            continue;
+        }
+
+        // Read resource declaration.
+        ReflectedBinding binding{};
+        binding.bIsAutoAssigned = true;
+        binding.iSpace = readGlslDescriptorSet(sFullSourceCode, iBindingIndexPositionToReplace);
+        if (pReflectedBindings != nullptr || bindingIndicesInfo.bShareIndicesBetweenSameResources) {
+            readResourceDeclaration(bParseAsHlsl, sFullSourceCode, iBindingIndexPositionToReplace, binding);
+        }
+
+        // See if the same resource already has an index (for example in another shader stage).
+        const auto iAlreadyAssignedIndex = findResourceBindingIndex(bindingIndicesInfo, binding);
+        if (iAlreadyAssignedIndex.has_value()) {
+            binding.iBindingIndex = iAlreadyAssignedIndex.value();
+        } else {
+            // Take the first free index and mark it as used (also for other shader stages).
+            auto& usedIndices = bindingIndicesInfo.getUsedGlslIndices(binding.iSpace);
+            binding.iBindingIndex = usedIndices.findFreeIndex(iBaseAutomaticBindingIndex);
+            usedIndices.markUsed(binding.iBindingIndex);
+
+            if (bindingIndicesInfo.bShareIndicesBetweenSameResources && !binding.sResourceName.empty()) {
+                bindingIndicesInfo.resourceBindingIndices.emplace(
+                    getResourceKey(binding), binding.iBindingIndex);
+            }
+        }
+
+        // Replace our special character with this index.
+        sFullSourceCode.erase(iBindingIndexPositionToReplace, 1);
+        sFullSourceCode.insert(iBindingIndexPositionToReplace, std::to_string(binding.iBindingIndex));
+
+        // Update current position (because we might have changed string length).
+        iCurrentPos = iBindingIndexPositionToReplace;
+
+        if (pReflectedBindings != nullptr) {
+            pReflectedBindings->push_back(std::move(binding));
+        }
+    } while (iCurrentPos < sFullSourceCode.size());
+
+    return {};
+}
+#endif
+
+#if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
+std::optional<std::string> CombinedShaderLanguageParser::findHlslRegisterInfo(
+    std::string& sSourceCode,
+    size_t& iCurrentPos,
+    const std::function<std::optional<std::string>()>& onReachedRegisterType,
+    const std::function<std::optional<std::string>()>& onReachedRegisterIndex,
+    const std::function<std::optional<std::string>()>& onReachedRegisterSpaceIndex) {
+    // Find binding keyword.
+    iCurrentPos = sSourceCode.find(sHlslBindingKeyword, iCurrentPos);
+    if (iCurrentPos == std::string::npos) {
+        return {};
+    }
+
+    // Jump to binding value.
+    iCurrentPos += sHlslBindingKeyword.size();
+
+    // Skip spaces (if found).
+    for (; iCurrentPos < sSourceCode.size(); iCurrentPos++) {
+        if (sSourceCode[iCurrentPos] != ' ') {
+            break;
+        }
+    }
+    if (iCurrentPos >= sSourceCode.size()) [[unlikely]] {
+        return std::format("found \"{}\" but not found register type", sHlslBindingKeyword);
+    }
+
+    // Reached register type.
+    auto optionalError = onReachedRegisterType();
+    if (optionalError.has_value()) [[unlikely]] {
+        return optionalError;
+    }
+
+    // Check if user wants to quit.
+    if (iCurrentPos == std::string::npos) {
+        return {};
+    }
+    iCurrentPos += 1;
+
+    // Skip spaces (if found).
+    for (; iCurrentPos < sSourceCode.size(); iCurrentPos++) {
+        if (sSourceCode[iCurrentPos] != ' ') {
+            break;
+        }
+    }
+    if (iCurrentPos >= sSourceCode.size()) [[unlikely]] {
+        return "found register type but no register index";
+    }
+
+    // Reached register index.
+    optionalError = onReachedRegisterIndex();
+    if (optionalError.has_value()) [[unlikely]] {
+        return optionalError;
+    }
+
+    // Check if user wants to quit.
+    if (iCurrentPos == std::string::npos) {
+        return {};
+    }
+
+    // Find closing bracket position.
+    const auto iClosingBracketPosition = sSourceCode.find(')', iCurrentPos);
+
+    // Find register space keyword.
+    const auto iRegisterSpacePos = sSourceCode.find(sHlslRegisterSpaceKeyword.data(), iCurrentPos);
+    if (iRegisterSpacePos != std::string::npos &&
+        iRegisterSpacePos < iClosingBracketPosition) { // Make sure this register space is for our register
+                                                       // (not some next register).
+        iCurrentPos = iRegisterSpacePos + sHlslRegisterSpaceKeyword.size();
+        optionalError = onReachedRegisterSpaceIndex();
+        if (optionalError.has_value()) [[unlikely]] {
+            return optionalError;
+        }
+
+        // Check if user wants to quit.
+        if (iCurrentPos == std::string::npos) {
+            return {};
+        }
+    }
+
+    iCurrentPos = iClosingBracketPosition;
+
+    return {};
+}
+#endif
+
+#if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
+std::optional<std::string> CombinedShaderLanguageParser::findGlslBindingIndex(
+    std::string& sSourceCode,
+    size_t& iCurrentPos,
+    const std::function<std::optional<std::string>()>& onReachedBindingIndex) {
+    // Find binding keyword.
+    iCurrentPos = sSourceCode.find(sGlslBindingKeyword, iCurrentPos);
+    if (iCurrentPos == std::string::npos) {
+        return {};
+    }
+
+    // Jump to keyword end.
+    iCurrentPos += sGlslBindingKeyword.size();
+
+    // Go forward until `=` is found.
+    for (; iCurrentPos < sSourceCode.size(); iCurrentPos++) {
+        if (sSourceCode[iCurrentPos] == '=') {
+            break;
+        }
+    }
+    if (iCurrentPos >= sSourceCode.size()) [[unlikely]] {
+        return std::format("found \"{}\" but not found `=` after it", sGlslBindingKeyword);
+    }
+
+    // Skip `=`.
+    iCurrentPos += 1;
+
+    // Go forward until a non-space character is found.
+    for (; iCurrentPos < sSourceCode.size(); iCurrentPos++) {
+        if (sSourceCode[iCurrentPos] != ' ') {
+            break;
+        }
+    }
+    if (iCurrentPos >= sSourceCode.size()) [[unlikely]] {
+        return std::format("found \"{}\" but not found binding index after it", sGlslBindingKeyword);
+    }
+
+    onReachedBindingIndex();
+
+    return {};
+}
+#endif
+
+#if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
+void CombinedShaderLanguageParser::readResourceDeclaration(
+    bool bParseAsHlsl,
+    const std::string& sSourceCode,
+    size_t iBindingPosition,
+    ReflectedBinding& reflectedBinding) {
+    // Find declaration bounds.
+    size_t iDeclarationStartPos = 0;
+    size_t iDeclarationEndPos = 0;
+    if (bParseAsHlsl) {
+        // Declaration is located before `:` (for example `Texture2D diffuseTexture : register(t0)`).
+        iDeclarationEndPos = sSourceCode.rfind(':', iBindingPosition);
+        if (iDeclarationEndPos == std::string::npos) [[unlikely]] {
+            return;
+        }
+
+        iDeclarationStartPos = sSourceCode.find_last_of(";{}\n", iDeclarationEndPos);
+        iDeclarationStartPos = iDeclarationStartPos == std::string::npos ? 0 : iDeclarationStartPos + 1;
+    } else {
+        // Declaration is located after `layout(...)` (for example `uniform sampler2D diffuseTexture;`).
+        iDeclarationStartPos = sSourceCode.find(')', iBindingPosition);
+        if (iDeclarationStartPos == std::string::npos) [[unlikely]] {
+            return;
+        }
+        iDeclarationStartPos += 1;
+
+        iDeclarationEndPos = sSourceCode.find_first_of(";{", iDeclarationStartPos);
+        if (iDeclarationEndPos == std::string::npos) [[unlikely]] {
+            return;
+        }
+    }
+
+    // Trim spaces and array brackets from the end.
+    std::string_view sDeclaration(
+        sSourceCode.data() + iDeclarationStartPos, iDeclarationEndPos - iDeclarationStartPos);
+    const auto iArrayStartPos = sDeclaration.find('[');
+    if (iArrayStartPos != std::string_view::npos) {
+        // Read array size (empty brackets mean unbounded array).
+        auto readResult = readNumberFromString(sSourceCode, iDeclarationStartPos + iArrayStartPos + 1);
+        reflectedBinding.iArraySize =
+            std::holds_alternative<unsigned int>(readResult) ? std::get<unsigned int>(readResult) : 0;
+
+        sDeclaration = sDeclaration.substr(0, iArrayStartPos);
+    }
+    while (!sDeclaration.empty() && std::isspace(static_cast<unsigned char>(sDeclaration.back())) != 0) {
+        sDeclaration.remove_suffix(1);
+    }
+    while (!sDeclaration.empty() && std::isspace(static_cast<unsigned char>(sDeclaration.front())) != 0) {
+        sDeclaration.remove_prefix(1);
+    }
+
+    // The last word is the name, everything before it is the type.
+    const auto iNameStartPos = sDeclaration.find_last_of(" \t\n>");
+    if (iNameStartPos == std::string_view::npos) {
+        reflectedBinding.sResourceName = sDeclaration;
+        return;
+    }
+    reflectedBinding.sResourceName = sDeclaration.substr(iNameStartPos + 1);
+
+    auto sType = sDeclaration.substr(0, iNameStartPos + 1);
+    while (!sType.empty() && std::isspace(static_cast<unsigned char>(sType.back())) != 0) {
+        sType.remove_suffix(1);
+    }
+    reflectedBinding.sDeclaredType = sType;
+    reflectedBinding.resourceKind = inferShaderResourceKind(bParseAsHlsl, reflectedBinding);
+}
+
+std::optional<std::string> CombinedShaderLanguageParser::findGlslInterfaceVariables(
+    const std::string& sSourceCode, std::vector<GlslInterfaceVariable>& vVariables) {
+    for (auto iLayoutPos = sSourceCode.find(sGlslLayoutKeyword); iLayoutPos != std::string::npos;
+         iLayoutPos = sSourceCode.find(sGlslLayoutKeyword, iLayoutPos + 1)) {
+        // Look for location.
+        const auto iLayoutBracketPos = iLayoutPos + sGlslLayoutKeyword.size() - 1;
+        const auto iLocationValuePos =
+            findGlslLayoutQualifierValue(sSourceCode, iLayoutBracketPos, sGlslLocationKeyword);
+        if (iLocationValuePos == std::string::npos) {
+            continue;
+        }
+
+        GlslInterfaceVariable variable{};
+        variable.iLocationValuePosition = iLocationValuePos;
+        variable.bIsAutoAssigned = sSourceCode[iLocationValuePos] == assignBindingIndexCharacter;
+        if (!variable.bIsAutoAssigned) {
+            auto readResult = readNumberFromString(sSourceCode, iLocationValuePos);
+            if (std::holds_alternative<std::string>(readResult)) [[unlikely]] {
+                return std::format(
+                    "failed to read location value, error: {}", std::get<std::string>(std::move(readResult)));
+            }
+            variable.iLocation = std::get<unsigned int>(readResult);
+        }
+
+        // Find declaration bounds (declaration is located after `layout(...)`).
+        const auto iDeclarationStartPos = sSourceCode.find(')', iLocationValuePos);
+        const auto iDeclarationEndPos = sSourceCode.find_first_of(";{", iDeclarationStartPos);
+        if (iDeclarationStartPos == std::string::npos || iDeclarationEndPos == std::string::npos)
+            [[unlikely]] {
+            return "unable to find declaration of a variable that uses `location`";
+        }
+        auto sDeclaration =
+            sSourceCode.substr(iDeclarationStartPos + 1, iDeclarationEndPos - iDeclarationStartPos - 1);
+
+        // Read array size.
+        unsigned int iArraySize = 1;
+        const auto iArrayStartPos = sDeclaration.find('[');
+        if (iArrayStartPos != std::string::npos) {
+            // Unbounded arrays (inputs of geometry/tessellation shaders) use locations of one element.
+            auto readResult = readNumberFromString(sDeclaration, iArrayStartPos + 1);
+            if (std::holds_alternative<unsigned int>(readResult)) {
+                iArraySize = std::get<unsigned int>(readResult);
+            }
+            sDeclaration.erase(iArrayStartPos);
+        }
+
+        // Split into words.
+        std::vector<std::string> vWords;
+        std::string sWord;
+        for (const auto character : sDeclaration + ' ') {
+            if (std::isspace(static_cast<unsigned char>(character)) != 0) {
+                if (!sWord.empty()) {
+                    vWords.push_back(std::move(sWord));
+                    sWord.clear();
+                }
+                continue;
+            }
+            sWord += character;
+        }
+
+        // Make sure this is an input or an output.
+        const auto bIsInput = std::ranges::find(vWords, "in") != vWords.end();
+        const auto bIsOutput = std::ranges::find(vWords, "out") != vWords.end();
+        if (!bIsInput && !bIsOutput) {
+            if (variable.bIsAutoAssigned) [[unlikely]] {
+                return "`location = ?` is only supported for shader inputs and outputs";
+            }
+            continue;
+        }
+        variable.bIsInput = bIsInput;
+
+        if (sSourceCode[iDeclarationEndPos] == '{' || vWords.size() < 2) {
+            if (variable.bIsAutoAssigned) [[unlikely]] {
+                return "`location = ?` is not supported for interface blocks";
+            }
+            vVariables.push_back(std::move(variable));
+            continue;
+        }
+
+        // The last word is the name and the word before it is the type.
+        variable.sName = vWords.back();
+        const auto& sType = vWords[vWords.size() - 2];
+        const auto optionalType = getShaderConstantType(sType, false, false);
+        if (!optionalType.has_value()) {
+            if (variable.bIsAutoAssigned) [[unlikely]] {
+                return std::format(
+                    "unable to determine the number of locations used by type \"{}\" of \"{}\"",
+                    sType,
+                    variable.sName);
+            }
+        } else {
+            // 64 bit vectors with more than 2 components take 2 locations.
+            const auto iLocationsPerVector =
+                optionalType->iComponentSize > 4 && optionalType->iComponentCount > 2 ? 2 : 1; // NOLINT
+            variable.iLocationCount = optionalType->iVectorCount * iLocationsPerVector * iArraySize;
+        }
+
+        vVariables.push_back(std::move(variable));
+    }
+
+    return {};
+}
+
+std::optional<std::string> CombinedShaderLanguageParser::assignGlslLocations(
+    std::string& sFullSourceCode,
+    BindingIndicesInfo& bindingIndicesInfo,
+    const std::vector<std::string>& vVertexInputOrder) {
+    // Find all inputs and outputs.
+    std::vector<GlslInterfaceVariable> vVariables;
+    auto optionalError = findGlslInterfaceVariables(sFullSourceCode, vVariables);
+    if (optionalError.has_value()) [[unlikely]] {
+        return optionalError;
+    }
+
+    // Mark hardcoded locations as used.
+    BindingIndexSet usedInputLocations;
+    BindingIndexSet usedOutputLocations;
+    std::unordered_map<std::string, unsigned int> outputLocations;
+    const auto markUsed = [](BindingIndexSet& usedLocations, const GlslInterfaceVariable& variable) {
+        for (unsigned int i = 0; i < variable.iLocationCount; i++) {
+            usedLocations.markUsed(variable.iLocation + i);
+        }
+    };
+    for (const auto& variable : vVariables) {
+        if (variable.bIsAutoAssigned) {
+            continue;
+        }
+        markUsed(variable.bIsInput ? usedInputLocations : usedOutputLocations, variable);
+        if (!variable.bIsInput && !variable.sName.empty()) {
+            outputLocations[variable.sName] = variable.iLocation;
+        }
+    }
+
+    // Prepare a lambda to find free consecutive locations.
+    const auto findFreeLocations = [](const BindingIndexSet& usedLocations, unsigned int iLocationCount) {
+        auto iLocation = usedLocations.findFreeIndex(0);
+        while (true) {
+            unsigned int iFreeCount = 1;
+            while (iFreeCount < iLocationCount && !usedLocations.isUsed(iLocation + iFreeCount)) {
+                iFreeCount += 1;
+            }
+            if (iFreeCount == iLocationCount) {
+                return iLocation;
+            }
+            iLocation = usedLocations.findFreeIndex(iLocation + iFreeCount);
+        }
+    };
+
+    // Collect inputs to assign.
+    std::vector<GlslInterfaceVariable*> vInputs;
+    for (auto& variable : vVariables) {
+        if (variable.bIsAutoAssigned && variable.bIsInput) {
+            vInputs.push_back(&variable);
+        }
+    }
+
+    if (!bindingIndicesInfo.optionalPreviousStageOutputLocations.has_value()) {
+        // First stage, use the order of the vertex buffer layout.
+        std::ranges::stable_sort(
+            vInputs, [&](const GlslInterfaceVariable* pA, const GlslInterfaceVariable* pB) {
+                return std::ranges::find(vVertexInputOrder, pA->sName) <
+                       std::ranges::find(vVertexInputOrder, pB->sName);
+            });
+    } else {
+        // Inputs that match outputs of the previous stage use the same locations.
+        const auto& previousStageOutputs = bindingIndicesInfo.optionalPreviousStageOutputLocations.value();
+        for (auto& pInput : vInputs) {
+            const auto it = previousStageOutputs.find(pInput->sName);
+            if (it == previousStageOutputs.end()) {
+                continue;
+            }
+            pInput->iLocation = it->second;
+            markUsed(usedInputLocations, *pInput);
+            pInput = nullptr;
+        }
+    }
+
+    // Densely pack other inputs.
+    for (auto* pInput : vInputs) {
+        if (pInput == nullptr) {
+            continue;
+        }
+        pInput->iLocation = findFreeLocations(usedInputLocations, pInput->iLocationCount);
+        markUsed(usedInputLocations, *pInput);
+    }
+
+    // Densely pack outputs.
+    for (auto& variable : vVariables) {
+        if (!variable.bIsAutoAssigned || variable.bIsInput) {
+            continue;
+        }
+        variable.iLocation = findFreeLocations(usedOutputLocations, variable.iLocationCount);
+        markUsed(usedOutputLocations, variable);
+        outputLocations[variable.sName] = variable.iLocation;
+    }
+
+    // Replace in reverse order to keep positions valid.
+    for (auto it = vVariables.rbegin(); it != vVariables.rend(); ++it) {
+        if (it->bIsAutoAssigned) {
+            sFullSourceCode.replace(it->iLocationValuePosition, 1, std::to_string(it->iLocation));
+        }
+    }
+
+    // Next stage will match its inputs with these outputs.
+    bindingIndicesInfo.optionalPreviousStageOutputLocations = std::move(outputLocations);
+
+    return {};
+}
+
+CombinedShaderLanguageParser::ShaderResourceKind
+CombinedShaderLanguageParser::inferShaderResourceKind(bool bParseAsHlsl, const ReflectedBinding& binding) {
+    // Get the last word of the declared type (skipping template arguments).
+    std::string_view sType = binding.sDeclaredType;
+    sType = sType.substr(0, sType.find('<'));
+    const auto iLastWordStartPos = sType.find_last_of(" \t\n");
+    const auto sTypeName =
+        iLastWordStartPos == std::string_view::npos ? sType : sType.substr(iLastWordStartPos + 1);
+
+    if (bParseAsHlsl) {
+        if (sTypeName == "cbuffer" || sTypeName == "ConstantBuffer") {
+            return ShaderResourceKind::UNIFORM_BUFFER;
+        }
+        if (sTypeName.ends_with("StructuredBuffer") || sTypeName.ends_with("ByteAddressBuffer")) {
+            return ShaderResourceKind::STORAGE_BUFFER;
+        }
+        if (sTypeName.starts_with("RWTexture") || sTypeName == "RWBuffer") {
+            return ShaderResourceKind::STORAGE_TEXTURE;
+        }
+        if (sTypeName.starts_with("Texture") || sTypeName == "Buffer") {
+            return ShaderResourceKind::SAMPLED_TEXTURE;
+        }
+        if (sTypeName.starts_with("Sampler")) {
+            return ShaderResourceKind::SAMPLER;
+        }
+
+        // Use register type.
+        switch (binding.registerType) {
+        case ('b'):
+            return ShaderResourceKind::UNIFORM_BUFFER;
+        case ('t'):
+            return ShaderResourceKind::SAMPLED_TEXTURE;
+        case ('u'):
+            return ShaderResourceKind::STORAGE_TEXTURE;
+        case ('s'):
+            return ShaderResourceKind::SAMPLER;
+        default:
+            return ShaderResourceKind::UNKNOWN;
+        }
+    }
+
+    // Blocks have only qualifiers before the name.
+    if (sTypeName == "uniform") {
+        return ShaderResourceKind::UNIFORM_BUFFER;
+    }
+    if (sTypeName == "buffer") {
+        return ShaderResourceKind::STORAGE_BUFFER;
+    }
+
+    // Skip integer prefix (for example `usampler2D`).
+    auto sOpaqueType = sTypeName;
+    if (sOpaqueType.starts_with('i') || sOpaqueType.starts_with('u')) {
+        const auto sWithoutPrefix = sOpaqueType.substr(1);
+        if (sWithoutPrefix.starts_with("sampler") || sWithoutPrefix.starts_with("texture") ||
+            sWithoutPrefix.starts_with("image")) {
+            sOpaqueType = sWithoutPrefix;
+        }
+    }
+    if (sOpaqueType == "sampler" || sOpaqueType == "samplerShadow") {
+        return ShaderResourceKind::SAMPLER;
+    }
+    if (sOpaqueType.starts_with("sampler")) {
+        return ShaderResourceKind::COMBINED_TEXTURE_SAMPLER;
+    }
+    if (sOpaqueType.starts_with("texture")) {
+        return ShaderResourceKind::SAMPLED_TEXTURE;
+    }
+    if (sOpaqueType.starts_with("image")) {
+        return ShaderResourceKind::STORAGE_TEXTURE;
+    }
+
+    return ShaderResourceKind::UNKNOWN;
+}
+
+std::optional<CombinedShaderLanguageParser::Error> CombinedShaderLanguageParser::exportDescriptorLayout(
+    const std::filesystem::path& pathToFile,
+    DescriptorLayoutFormat format,
+    const std::vector<ReflectedBinding>& vBindings,
+    const std::optional<ShaderConstantsLayout>& optionalShaderConstants) {
+    // Group bindings by sets/spaces.
+    std::vector<const ReflectedBinding*> vSortedBindings;
+    vSortedBindings.reserve(vBindings.size());
+    for (const auto& binding : vBindings) {
+        vSortedBindings.push_back(&binding);
+    }
+    std::ranges::stable_sort(vSortedBindings, [](const ReflectedBinding* pA, const ReflectedBinding* pB) {
+        return std::tie(pA->iSpace, pA->registerType, pA->iBindingIndex) <
+               std::tie(pB->iSpace, pB->registerType, pB->iBindingIndex);
+    });
+
+    constexpr std::array<std::string_view, 7> vResourceKindNames = {
+        "unknown",
+        "uniform_buffer",
+        "storage_buffer",
+        "sampled_texture",
+        "storage_texture",
+        "sampler",
+        "combined_texture_sampler"};
+
+    std::string sFileContent;
+    if (format == DescriptorLayoutFormat::JSON) {
+        sFileContent += "{\n    \"sets\": [";
+        for (size_t i = 0; i < vSortedBindings.size(); i++) {
+            const auto& binding = *vSortedBindings[i];
+
+            // Start a new set if needed.
+            const auto bIsNewSet = i == 0 || vSortedBindings[i - 1]->iSpace != binding.iSpace;
+            if (bIsNewSet) {
+                sFileContent += std::format(
+                    "{}\n        {{\"set\": {}, \"bindings\": [\n",
+                    i == 0 ? "" : "\n        ]},",
+                    binding.iSpace);
+            } else {
+                sFileContent += ",\n";
+            }
+
+            sFileContent += std::format(
+                "            {{\"binding\": {}, \"name\": \"{}\", \"kind\": \"{}\", \"arraySize\": {}",
+                binding.iBindingIndex,
+                binding.sResourceName,
+                vResourceKindNames[static_cast<size_t>(binding.resourceKind)],
+                binding.iArraySize);
+            if (binding.registerType != 0) {
+                sFileContent += std::format(", \"register\": \"{}\"", binding.registerType);
+            }
+            sFileContent += "}";
+        }
+        sFileContent += vSortedBindings.empty() ? "],\n" : "\n        ]}\n    ],\n";
+
+        sFileContent += "    \"pushConstantRanges\": [";
+        if (optionalShaderConstants.has_value() && optionalShaderConstants->iTotalSize > 0) {
+            sFileContent +=
+                std::format("{{\"offset\": 0, \"size\": {}}}", optionalShaderConstants->iTotalSize);
+        }
+        sFileContent += "]\n}\n";
+    } else {
+        const auto writeUint = [&](uint32_t iValue) {
+            for (size_t i = 0; i < sizeof(iValue); i++) {
+                sFileContent += static_cast<char>((iValue >> (i * 8)) & 0xFF); // NOLINT: byte by byte
+            }
+        };
+
+        sFileContent += sDescriptorLayoutBinaryMagic;
+        writeUint(iDescriptorLayoutBinaryVersion);
+
+        // Count sets.
+        uint32_t iSetCount = 0;
+        for (size_t i = 0; i < vSortedBindings.size(); i++) {
+            if (i == 0 || vSortedBindings[i - 1]->iSpace != vSortedBindings[i]->iSpace) {
+                iSetCount += 1;
+            }
+        }
+        writeUint(iSetCount);
+
+        for (size_t i = 0; i < vSortedBindings.size();) {
+            // Count bindings of this set.
+            const auto iSpace = vSortedBindings[i]->iSpace;
+            size_t iSetEnd = i;
+            while (iSetEnd < vSortedBindings.size() && vSortedBindings[iSetEnd]->iSpace == iSpace) {
+                iSetEnd += 1;
+            }
+            writeUint(iSpace);
+            writeUint(static_cast<uint32_t>(iSetEnd - i));
+
+            for (; i < iSetEnd; i++) {
+                const auto& binding = *vSortedBindings[i];
+                writeUint(binding.iBindingIndex);
+                writeUint(static_cast<uint32_t>(binding.resourceKind));
+                writeUint(binding.iArraySize);
+                writeUint(static_cast<uint32_t>(binding.registerType));
+                writeUint(static_cast<uint32_t>(binding.sResourceName.size()));
+                sFileContent += binding.sResourceName;
+            }
+        }
+
+        if (optionalShaderConstants.has_value() && optionalShaderConstants->iTotalSize > 0) {
+            writeUint(1);
+            writeUint(0);
+            writeUint(optionalShaderConstants->iTotalSize);
+        } else {
+            writeUint(0);
+        }
+    }
+
+    // Write to a temporary file first to not leave a broken file if something goes wrong.
+    auto pathToTemporaryFile = pathToFile;
+    pathToTemporaryFile += ".tmp";
+    {
+        std::ofstream file(pathToTemporaryFile, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) [[unlikely]] {
+            return Error("failed to open descriptor layout file for writing", pathToTemporaryFile);
+        }
+
+        file.write(sFileContent.data(), static_cast<std::streamsize>(sFileContent.size()));
+        if (!file.good()) [[unlikely]] {
+            return Error("failed to write descriptor layout file", pathToTemporaryFile);
+        }
+    }
+
+    std::error_code errorCode;
+    std::filesystem::rename(pathToTemporaryFile, pathToFile, errorCode);
+    if (errorCode) [[unlikely]] {
+        return Error(
+            std::format("failed to replace descriptor layout file, error: {}", errorCode.message()),
+            pathToFile);
+    }
+
+    return {};
+}
+
+std::optional<CombinedShaderLanguageParser::Error> CombinedShaderLanguageParser::loadBindingLockFile(
+    const std::filesystem::path& pathToBindingLockFile,
+    const std::filesystem::path& pathToShaderSourceFile,
+    BindingIndicesInfo& bindingIndicesInfo) {
+    // Read the file.
+    auto result = readBindingLockFile(pathToBindingLockFile);
+    if (std::holds_alternative<Error>(result)) [[unlikely]] {
+        return std::get<Error>(std::move(result));
+    }
+    const auto vLockedBindings = std::get<std::vector<LockedBinding>>(std::move(result));
+
+    const auto sShaderPath = getBindingLockFileShaderPath(pathToBindingLockFile, pathToShaderSourceFile);
+    for (const auto& lockedBinding : vLockedBindings) {
+        if (lockedBinding.sShaderPath != sShaderPath) {
+            continue;
+        }
+
+        // Skip resources that were removed (to free their indices).
+        auto sResourceKey = getResourceKey(lockedBinding.binding);
+        if (!bindingIndicesInfo.resourcesToAssign.contains(sResourceKey)) {
+            continue;
+        }
+
+        // Skip indices that are now hardcoded (or reserved by another resource).
+        auto* pUsedIndices = lockedBinding.binding.registerType == 0
+                                 ? &bindingIndicesInfo.getUsedGlslIndices(lockedBinding.binding.iSpace)
+                                 : bindingIndicesInfo.usedHlslIndices.getUsedIndices(
+                                       lockedBinding.binding.registerType, lockedBinding.binding.iSpace);
+        if (pUsedIndices == nullptr || !pUsedIndices->markUsed(lockedBinding.binding.iBindingIndex)) {
+            continue;
+        }
+
+        bindingIndicesInfo.resourceBindingIndices.emplace(
+            std::move(sResourceKey), lockedBinding.binding.iBindingIndex);
+    }
+
+    return {};
+}
+
+std::optional<CombinedShaderLanguageParser::Error> CombinedShaderLanguageParser::saveBindingLockFile(
+    const std::filesystem::path& pathToBindingLockFile,
+    const std::filesystem::path& pathToShaderSourceFile,
+    const std::vector<ReflectedBinding>& vBindings) {
+    // Don't let other processes update the file until we are finished.
+    auto pathToFileLock = pathToBindingLockFile;
+    pathToFileLock += ".lock";
+    auto lockResult = FileLock::lock(pathToFileLock);
+    if (std::holds_alternative<std::string>(lockResult)) [[unlikely]] {
+        return Error(std::get<std::string>(std::move(lockResult)), pathToFileLock);
+    }
+    const auto pFileLock = std::get<std::unique_ptr<FileLock>>(std::move(lockResult));
+
+    // Read the file to keep entries of other shaders.
+    auto result = readBindingLockFile(pathToBindingLockFile);
+    if (std::holds_alternative<Error>(result)) [[unlikely]] {
+        return std::get<Error>(std::move(result));
+    }
+    const auto vLockedBindings = std::get<std::vector<LockedBinding>>(std::move(result));
+
+    const auto sShaderPath = getBindingLockFileShaderPath(pathToBindingLockFile, pathToShaderSourceFile);
+
+    // Write to a temporary file first to not leave a broken file if something goes wrong.
+    auto pathToTemporaryFile = pathToBindingLockFile;
+    pathToTemporaryFile += std::format(".{}.tmp", std::random_device{}());
+    {
+        std::ofstream file(pathToTemporaryFile, std::ios::trunc);
+        if (!file.is_open()) [[unlikely]] {
+            return Error("failed to open binding lock file for writing", pathToTemporaryFile);
+        }
+
+        // Write other shaders.
+        const auto writeEntry = [&](const std::string& sShader, const ReflectedBinding& binding) {
+            file << std::format(
+                "{}\t{}\t{}\t{}\t{}\t{}\n",
+                sShader,
+                static_cast<int>(binding.registerType),
+                binding.iSpace,
+                binding.iBindingIndex,
+                binding.sDeclaredType,
+                binding.sResourceName);
+        };
+        for (const auto& lockedBinding : vLockedBindings) {
+            if (lockedBinding.sShaderPath != sShaderPath) {
+                writeEntry(lockedBinding.sShaderPath, lockedBinding.binding);
+            }
+        }
+
+        // Write this shader.
+        for (const auto& binding : vBindings) {
+            if (binding.bIsAutoAssigned && !binding.sResourceName.empty()) {
+                writeEntry(sShaderPath, binding);
+            }
+        }
+
+        if (!file.good()) [[unlikely]] {
+            return Error("failed to write binding lock file", pathToTemporaryFile);
+        }
+    }
+
+    std::error_code errorCode;
+    std::filesystem::rename(pathToTemporaryFile, pathToBindingLockFile, errorCode);
+    if (errorCode) [[unlikely]] {
+        std::filesystem::remove(pathToTemporaryFile, errorCode);
+        return Error(
+            std::format("failed to replace binding lock file, error: {}", errorCode.message()),
+            pathToBindingLockFile);
+    }
+
+    return {};
+}
+
+std::string CombinedShaderLanguageParser::getBindingLockFileShaderPath(
+    const std::filesystem::path& pathToBindingLockFile, const std::filesystem::path& pathToShaderSourceFile) {
+    const auto pathToShader = std::filesystem::absolute(pathToShaderSourceFile).lexically_normal();
+    const auto pathRelativeToLockFile = pathToShader.lexically_relative(
+        std::filesystem::absolute(pathToBindingLockFile).lexically_normal().parent_path());
+    if (pathRelativeToLockFile.empty()) {
+        // On a different drive.
+        return pathToShader.generic_string();
+    }
+    return pathRelativeToLockFile.generic_string();
+}
+
+std::variant<std::vector<CombinedShaderLanguageParser::LockedBinding>, CombinedShaderLanguageParser::Error>
+CombinedShaderLanguageParser::readBindingLockFile(const std::filesystem::path& pathToBindingLockFile) {
+    std::vector<LockedBinding> vLockedBindings;
+    if (!std::filesystem::exists(pathToBindingLockFile)) {
+        return vLockedBindings;
+    }
+
+    std::ifstream file(pathToBindingLockFile);
+    if (!file.is_open()) [[unlikely]] {
+        return Error("can't open binding lock file", pathToBindingLockFile);
+    }
+
+    // Each line is: shader path, register type, space, index, declared type, resource name.
+    constexpr size_t iFieldCount = 6;
+    std::string sLineBuffer;
+    while (std::getline(file, sLineBuffer)) {
+        if (sLineBuffer.empty()) {
             continue;
         }
 
-        // Make sure our index is not used.
-        while (bindingIndicesInfo.usedGlslIndices.find(iNextFreeBindingIndex) !=
-               bindingIndicesInfo.usedGlslIndices.end()) {
-            iNextFreeBindingIndex += 1;
+        // Split by tabs.
+        std::array<std::string, iFieldCount> vFields;
+        size_t iFieldIndex = 0;
+        size_t iFieldStartPos = 0;
+        for (; iFieldIndex < iFieldCount - 1; iFieldIndex++) {
+            const auto iTabPos = sLineBuffer.find('\t', iFieldStartPos);
+            if (iTabPos == std::string::npos) [[unlikely]] {
+                break;
+            }
+            vFields[iFieldIndex] = sLineBuffer.substr(iFieldStartPos, iTabPos - iFieldStartPos);
+            iFieldStartPos = iTabPos + 1;
+        }
+        if (iFieldIndex != iFieldCount - 1) [[unlikely]] {
+            return Error(
+                std::format("unexpected binding lock file line \"{}\"", sLineBuffer), pathToBindingLockFile);
         }
+        vFields[iFieldIndex] = sLineBuffer.substr(iFieldStartPos);
 
-        // Replace our special character with this index.
-        sFullSourceCode.erase(iBindingIndexPositionToReplace, 1);
-        sFullSourceCode.insert(iBindingIndexPositionToReplace, std::to_string(iNextFreeBindingIndex));
+        // Read numbers.
+        std::array<unsigned int, 3> vNumbers{};
+        for (size_t i = 0; i < vNumbers.size(); i++) {
+            auto readResult = readNumberFromString(vFields[i + 1], 0);
+            if (std::holds_alternative<std::string>(readResult)) [[unlikely]] {
+                return Error(
+                    std::format(
+                        "unexpected binding lock file line \"{}\", error: {}",
+                        sLineBuffer,
+                        std::get<std::string>(readResult)),
+                    pathToBindingLockFile);
+            }
+            vNumbers[i] = std::get<unsigned int>(readResult);
+        }
 
-        // Update current position (because we might have changed string length).
-        iCurrentPos = iBindingIndexPositionToReplace;
+        LockedBinding lockedBinding{};
+        lockedBinding.sShaderPath = std::move(vFields[0]);
+        lockedBinding.binding.registerType = static_cast<char>(vNumbers[0]);
+        lockedBinding.binding.iSpace = vNumbers[1];
+        lockedBinding.binding.iBindingIndex = vNumbers[2];
+        lockedBinding.binding.sDeclaredType = std::move(vFields[4]);
+        lockedBinding.binding.sResourceName = std::move(vFields[5]);
+        lockedBinding.binding.bIsAutoAssigned = true;
+        vLockedBindings.push_back(std::move(lockedBinding));
+    }
 
-        // Increment next free binding index (because the current one was assigned just now).
-        iNextFreeBindingIndex += 1;
-    } while (iCurrentPos < sFullSourceCode.size());
+    return vLockedBindings;
+}
 
-    return {};
+std::string CombinedShaderLanguageParser::getResourceKey(const ReflectedBinding& binding) {
+    return std::format(
+        "{}|{}|{}|{}",
+        static_cast<int>(binding.registerType),
+        binding.iSpace,
+        binding.sDeclaredType,
+        binding.sResourceName);
 }
-#endif
 
-#if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
-std::optional<std::string> CombinedShaderLanguageParser::findHlslRegisterInfo(
-    std::string& sSourceCode,
-    size_t& iCurrentPos,
-    const std::function<std::optional<std::string>()>& onReachedRegisterType,
-    const std::function<std::optional<std::string>()>& onReachedRegisterIndex,
-    const std::function<std::optional<std::string>()>& onReachedRegisterSpaceIndex) {
-    // Find binding keyword.
-    iCurrentPos = sSourceCode.find(sHlslBindingKeyword, iCurrentPos);
-    if (iCurrentPos == std::string::npos) {
+std::optional<unsigned int> CombinedShaderLanguageParser::findResourceBindingIndex(
+    const BindingIndicesInfo& bindingIndicesInfo, const ReflectedBinding& binding) {
+    if (!bindingIndicesInfo.bShareIndicesBetweenSameResources || binding.sResourceName.empty()) {
         return {};
     }
 
-    // Jump to binding value.
-    iCurrentPos += sHlslBindingKeyword.size();
-
-    // Skip spaces (if found).
-    for (; iCurrentPos < sSourceCode.size(); iCurrentPos++) {
-        if (sSourceCode[iCurrentPos] != ' ') {
-            break;
-        }
-    }
-    if (iCurrentPos >= sSourceCode.size()) [[unlikely]] {
-        return std::format("found \"{}\" but not found register type", sHlslBindingKeyword);
+    const auto it = bindingIndicesInfo.resourceBindingIndices.find(getResourceKey(binding));
+    if (it == bindingIndicesInfo.resourceBindingIndices.end()) {
+        return {};
     }
 
-    // Reached register type.
-    auto optionalError = onReachedRegisterType();
-    if (optionalError.has_value()) [[unlikely]] {
-        return optionalError;
-    }
+    return it->second;
+}
 
-    // Check if user wants to quit.
-    if (iCurrentPos == std::string::npos) {
-        return {};
+size_t CombinedShaderLanguageParser::findGlslLayoutQualifierValue(
+    const std::string& sSourceCode, size_t iPositionInLayout, std::string_view sQualifier) {
+    // Find `layout(...)` bounds.
+    const auto iLayoutStartPos = sSourceCode.rfind('(', iPositionInLayout);
+    const auto iLayoutEndPos = sSourceCode.find(')', iPositionInLayout);
+    if (iLayoutStartPos == std::string::npos || iLayoutEndPos == std::string::npos) [[unlikely]] {
+        return std::string::npos;
     }
-    iCurrentPos += 1;
 
-    // Skip spaces (if found).
-    for (; iCurrentPos < sSourceCode.size(); iCurrentPos++) {
-        if (sSourceCode[iCurrentPos] != ' ') {
-            break;
+    // Look for the qualifier.
+    auto iCurrentPos = sSourceCode.find(sQualifier, iLayoutStartPos);
+    while (iCurrentPos != std::string::npos && iCurrentPos < iLayoutEndPos) {
+        // Make sure it's not a part of some other word.
+        const auto prevChar = sSourceCode[iCurrentPos - 1];
+        const auto iAssignmentPos = sSourceCode.find_first_not_of(' ', iCurrentPos + sQualifier.size());
+        if ((prevChar == '(' || prevChar == ',' || prevChar == ' ') && iAssignmentPos < iLayoutEndPos &&
+            sSourceCode[iAssignmentPos] == '=') {
+            // Skip to the value.
+            iCurrentPos = sSourceCode.find_first_not_of(' ', iAssignmentPos + 1);
+            if (iCurrentPos == std::string::npos || iCurrentPos >= iLayoutEndPos) [[unlikely]] {
+                return std::string::npos;
+            }
+
+            return iCurrentPos;
         }
-    }
-    if (iCurrentPos >= sSourceCode.size()) [[unlikely]] {
-        return "found register type but no register index";
+
+        iCurrentPos = sSourceCode.find(sQualifier, iCurrentPos + 1);
     }
 
-    // Reached register index.
-    optionalError = onReachedRegisterIndex();
-    if (optionalError.has_value()) [[unlikely]] {
-        return optionalError;
+    return std::string::npos;
+}
+
+unsigned int
+CombinedShaderLanguageParser::readGlslDescriptorSet(const std::string& sSourceCode, size_t iBindingPosition) {
+    const auto iSetValuePos = findGlslLayoutQualifierValue(sSourceCode, iBindingPosition, sGlslSetKeyword);
+    if (iSetValuePos == std::string::npos) {
+        return 0;
     }
 
-    // Check if user wants to quit.
-    if (iCurrentPos == std::string::npos) {
-        return {};
+    auto readResult = readNumberFromString(sSourceCode, iSetValuePos);
+    if (std::holds_alternative<std::string>(readResult)) [[unlikely]] {
+        return 0;
     }
 
-    // Find closing bracket position.
-    const auto iClosingBracketPosition = sSourceCode.find(')', iCurrentPos);
+    return std::get<unsigned int>(readResult);
+}
 
-    // Find register space keyword.
-    const auto iRegisterSpacePos = sSourceCode.find(sHlslRegisterSpaceKeyword.data(), iCurrentPos);
-    if (iRegisterSpacePos != std::string::npos &&
-        iRegisterSpacePos < iClosingBracketPosition) { // Make sure this register space is for our register
-                                                       // (not some next register).
-        iCurrentPos = iRegisterSpacePos + sHlslRegisterSpaceKeyword.size();
-        optionalError = onReachedRegisterSpaceIndex();
-        if (optionalError.has_value()) [[unlikely]] {
-            return optionalError;
+std::optional<std::string> CombinedShaderLanguageParser::assignRegisterSpaces( // NOLINT: slightly complex
+    bool bParseAsHlsl,
+    std::string& sFullSourceCode,
+    BindingIndicesInfo& bindingIndicesInfo,
+    const std::vector<std::string>& vSpaceGroupOrder) {
+    // Prepare a struct to store info about a `?` set/space.
+    struct SpaceToAssign {
+        size_t iPosition = 0;
+        size_t iLength = 0;
+        std::string sGroupName;
+        char registerType = 0;
+        std::optional<unsigned int> optionalHardcodedIndex;
+    };
+    std::vector<SpaceToAssign> vSpacesToAssign;
+
+    // Reads group name after `?`.
+    const auto readSpaceToAssign = [&](size_t iPosition) -> SpaceToAssign {
+        SpaceToAssign spaceToAssign{};
+        spaceToAssign.iPosition = iPosition;
+        size_t iNameEndPos = iPosition + 1;
+        while (iNameEndPos < sFullSourceCode.size() &&
+               (std::isalnum(static_cast<unsigned char>(sFullSourceCode[iNameEndPos])) != 0 ||
+                sFullSourceCode[iNameEndPos] == '_')) {
+            iNameEndPos += 1;
         }
+        spaceToAssign.iLength = iNameEndPos - iPosition;
+        spaceToAssign.sGroupName = sFullSourceCode.substr(iPosition + 1, spaceToAssign.iLength - 1);
+        return spaceToAssign;
+    };
 
-        // Check if user wants to quit.
-        if (iCurrentPos == std::string::npos) {
-            return {};
-        }
-    }
+    // Collect all sets/spaces to assign.
+    size_t iCurrentPos = 0;
+    if (bParseAsHlsl) {
+        do {
+            char registerType = '0';
+            std::optional<unsigned int> optionalHardcodedIndex;
+            auto optionalError = findHlslRegisterInfo(
+                sFullSourceCode,
+                iCurrentPos,
+                [&]() -> std::optional<std::string> {
+                    registerType = sFullSourceCode[iCurrentPos];
+                    return {};
+                },
+                [&]() -> std::optional<std::string> {
+                    if (sFullSourceCode[iCurrentPos] == assignBindingIndexCharacter) {
+                        return {};
+                    }
 
-    iCurrentPos = iClosingBracketPosition;
+                    auto readResult = readNumberFromString(sFullSourceCode, iCurrentPos);
+                    if (std::holds_alternative<std::string>(readResult)) [[unlikely]] {
+                        return std::get<std::string>(std::move(readResult));
+                    }
+                    optionalHardcodedIndex = std::get<unsigned int>(readResult);
 
-    return {};
-}
-#endif
+                    return {};
+                },
+                [&]() -> std::optional<std::string> {
+                    if (sFullSourceCode[iCurrentPos] != assignBindingIndexCharacter) {
+                        return {};
+                    }
 
-#if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
-std::optional<std::string> CombinedShaderLanguageParser::findGlslBindingIndex(
-    std::string& sSourceCode,
-    size_t& iCurrentPos,
-    const std::function<std::optional<std::string>()>& onReachedBindingIndex) {
-    // Find binding keyword.
-    iCurrentPos = sSourceCode.find(sGlslBindingKeyword, iCurrentPos);
-    if (iCurrentPos == std::string::npos) {
-        return {};
-    }
+                    auto spaceToAssign = readSpaceToAssign(iCurrentPos);
+                    spaceToAssign.registerType = registerType;
+                    spaceToAssign.optionalHardcodedIndex = optionalHardcodedIndex;
+                    vSpacesToAssign.push_back(std::move(spaceToAssign));
 
-    // Jump to keyword end.
-    iCurrentPos += sGlslBindingKeyword.size();
+                    return {};
+                });
+            if (optionalError.has_value()) [[unlikely]] {
+                return optionalError;
+            }
+        } while (iCurrentPos < sFullSourceCode.size());
+    } else {
+        do {
+            iCurrentPos = sFullSourceCode.find(sGlslLayoutKeyword, iCurrentPos);
+            if (iCurrentPos == std::string::npos) {
+                break;
+            }
+            iCurrentPos += sGlslLayoutKeyword.size();
 
-    // Go forward until `=` is found.
-    for (; iCurrentPos < sSourceCode.size(); iCurrentPos++) {
-        if (sSourceCode[iCurrentPos] == '=') {
-            break;
+            const auto iSetValuePos =
+                findGlslLayoutQualifierValue(sFullSourceCode, iCurrentPos, sGlslSetKeyword);
+            if (iSetValuePos != std::string::npos &&
+                sFullSourceCode[iSetValuePos] == assignBindingIndexCharacter) {
+                vSpacesToAssign.push_back(readSpaceToAssign(iSetValuePos));
+            }
+        } while (iCurrentPos < sFullSourceCode.size());
+    }
+
+    // Order groups: groups from the specified order first, then in order of appearance.
+    std::vector<std::string> vGroups;
+    for (const auto& sGroupName : vSpaceGroupOrder) {
+        const auto bIsUsed = std::ranges::any_of(vSpacesToAssign, [&](const SpaceToAssign& spaceToAssign) {
+            return spaceToAssign.sGroupName == sGroupName;
+        });
+        if (bIsUsed) {
+            vGroups.push_back(sGroupName);
         }
     }
-    if (iCurrentPos >= sSourceCode.size()) [[unlikely]] {
-        return std::format("found \"{}\" but not found `=` after it", sGlslBindingKeyword);
+    for (const auto& spaceToAssign : vSpacesToAssign) {
+        if (std::ranges::find(vGroups, spaceToAssign.sGroupName) == vGroups.end()) {
+            vGroups.push_back(spaceToAssign.sGroupName);
+        }
     }
 
-    // Skip `=`.
-    iCurrentPos += 1;
+    // Assign lowest free set/space to each group.
+    auto& usedSpaces = bParseAsHlsl ? bindingIndicesInfo.usedHlslSpaces : bindingIndicesInfo.usedGlslSets;
+    for (const auto& sGroupName : vGroups) {
+        if (bindingIndicesInfo.assignedSpaceGroups.contains(sGroupName)) {
+            // Already assigned (for example in another shader stage).
+            continue;
+        }
 
-    // Go forward until a non-space character is found.
-    for (; iCurrentPos < sSourceCode.size(); iCurrentPos++) {
-        if (sSourceCode[iCurrentPos] != ' ') {
-            break;
+        unsigned int iFreeSpace = 0;
+        while (usedSpaces.contains(iFreeSpace)) {
+            iFreeSpace += 1;
         }
+        usedSpaces.insert(iFreeSpace);
+        bindingIndicesInfo.assignedSpaceGroups[sGroupName] = iFreeSpace;
     }
-    if (iCurrentPos >= sSourceCode.size()) [[unlikely]] {
-        return std::format("found \"{}\" but not found binding index after it", sGlslBindingKeyword);
+
+    // Replace in reverse order to keep positions valid.
+    for (auto it = vSpacesToAssign.rbegin(); it != vSpacesToAssign.rend(); ++it) {
+        const auto iSpace = bindingIndicesInfo.assignedSpaceGroups[it->sGroupName];
+        sFullSourceCode.replace(it->iPosition, it->iLength, std::to_string(iSpace));
+
+        // Now we know the space of this hardcoded register index.
+        auto* pUsedIndices = bindingIndicesInfo.usedHlslIndices.getUsedIndices(it->registerType, iSpace);
+        if (it->optionalHardcodedIndex.has_value() && pUsedIndices != nullptr) {
+            pUsedIndices->markUsed(it->optionalHardcodedIndex.value());
+        }
     }
 
-    onReachedBindingIndex();
+    // Now we know sets of hardcoded GLSL binding indices (including other shader stages using the same
+    // groups).
+    std::erase_if(bindingIndicesInfo.vHardcodedGlslIndicesInGroups, [&](const auto& hardcodedIndex) {
+        const auto it = bindingIndicesInfo.assignedSpaceGroups.find(hardcodedIndex.first);
+        if (it == bindingIndicesInfo.assignedSpaceGroups.end()) {
+            // Group is used only in other shader stages that were not processed yet.
+            return false;
+        }
+        bindingIndicesInfo.getUsedGlslIndices(it->second).markUsed(hardcodedIndex.second);
+        return true;
+    });
 
     return {};
 }
@@ -881,6 +4251,9 @@ std::optional<std::string> CombinedShaderLanguageParser::addHardcodedBindingInde
         char registerType = '0';
         unsigned int iRegisterIndex = 0;
         unsigned int iRegisterSpace = 0; // default space if not specified
+        size_t iRegisterTypePosition = 0;
+        bool bFoundIndexToAssign = false;
+        bool bFoundSpaceToAssign = false;
 
         // Find register values.
         auto optionalError = findHlslRegisterInfo(
@@ -889,6 +4262,7 @@ std::optional<std::string> CombinedShaderLanguageParser::addHardcodedBindingInde
             [&]() -> std::optional<std::string> {
                 // Reached register type.
                 registerType = sCodeLine[iCurrentPos];
+                iRegisterTypePosition = iCurrentPos;
 
                 return {};
             },
@@ -897,8 +4271,8 @@ std::optional<std::string> CombinedShaderLanguageParser::addHardcodedBindingInde
 
                 // Make sure it's not our keyword.
                 if (sCodeLine[iCurrentPos] == assignBindingIndexCharacter) {
-                    // Found our keyword, skip this line to assign a binding index later.
-                    iCurrentPos = std::string::npos;
+                    // Found our keyword, skip this register to assign a binding index later.
+                    bFoundIndexToAssign = true;
                     bindingIndicesInfo.bFoundBindingIndicesToAssign = true;
                     return {};
                 }
@@ -913,8 +4287,11 @@ std::optional<std::string> CombinedShaderLanguageParser::addHardcodedBindingInde
                 return {};
             },
             [&]() -> std::optional<std::string> {
-                if (sCodeLine[iCurrentPos] == assignBindingIndexCharacter) [[unlikely]] {
-                    return "`space?` is not supported";
+                if (sCodeLine[iCurrentPos] == assignBindingIndexCharacter) {
+                    // Space will be assigned later.
+                    bFoundSpaceToAssign = true;
+                    bindingIndicesInfo.bFoundSpacesToAssign = true;
+                    return {};
                 }
 
                 // Reached register space.
@@ -935,11 +4312,45 @@ std::optional<std::string> CombinedShaderLanguageParser::addHardcodedBindingInde
             return {};
         }
 
+        if (bFoundSpaceToAssign) {
+            // Used index (if hardcoded) will be added after the space is assigned.
+            return {};
+        }
+        bindingIndicesInfo.usedHlslSpaces.insert(iRegisterSpace);
+
+        if (bFoundIndexToAssign) {
+            if (bindingIndicesInfo.bShareIndicesBetweenSameResources) {
+                // Remember that this resource will need an index.
+                ReflectedBinding binding{};
+                binding.registerType = registerType;
+                binding.iSpace = iRegisterSpace;
+                readResourceDeclaration(bParseAsHlsl, sCodeLine, iRegisterTypePosition, binding);
+                if (!binding.sResourceName.empty()) {
+                    bindingIndicesInfo.resourcesToAssign.insert(getResourceKey(binding));
+                }
+            }
+            return {};
+        }
+
         // Don't check if register was already specified or not because some includes might be
         // hidden behind #ifdef which we don't expand.
 
-        // Add index as used.
-        bindingIndicesInfo.usedHlslIndices[registerType][iRegisterSpace].insert(iRegisterIndex);
+        // Add index as used (register types that don't support `?` are not tracked).
+        auto* pUsedIndices = bindingIndicesInfo.usedHlslIndices.getUsedIndices(registerType, iRegisterSpace);
+        if (pUsedIndices != nullptr) {
+            pUsedIndices->markUsed(iRegisterIndex);
+        }
+
+        if (bindingIndicesInfo.bShareIndicesBetweenSameResources) {
+            // Remember which resource uses this index.
+            ReflectedBinding binding{};
+            binding.registerType = registerType;
+            binding.iSpace = iRegisterSpace;
+            readResourceDeclaration(bParseAsHlsl, sCodeLine, iRegisterTypePosition, binding);
+            if (!binding.sResourceName.empty()) {
+                bindingIndicesInfo.resourceBindingIndices.emplace(getResourceKey(binding), iRegisterIndex);
+            }
+        }
 
         return {};
     }
@@ -948,9 +4359,39 @@ std::optional<std::string> CombinedShaderLanguageParser::addHardcodedBindingInde
 
     size_t iCurrentPos = 0;
     auto optionalError = findGlslBindingIndex(sCodeLine, iCurrentPos, [&]() -> std::optional<std::string> {
+        // Check descriptor set.
+        const auto iSetValuePos = findGlslLayoutQualifierValue(sCodeLine, iCurrentPos, sGlslSetKeyword);
+        std::optional<std::string> optionalSetGroupName;
+        unsigned int iSet = 0;
+        if (iSetValuePos != std::string::npos && sCodeLine[iSetValuePos] == assignBindingIndexCharacter) {
+            // Set will be assigned later.
+            bindingIndicesInfo.bFoundSpacesToAssign = true;
+
+            size_t iGroupNameEndPos = iSetValuePos + 1;
+            while (iGroupNameEndPos < sCodeLine.size() &&
+                   (std::isalnum(static_cast<unsigned char>(sCodeLine[iGroupNameEndPos])) != 0 ||
+                    sCodeLine[iGroupNameEndPos] == '_')) {
+                iGroupNameEndPos += 1;
+            }
+            optionalSetGroupName = sCodeLine.substr(iSetValuePos + 1, iGroupNameEndPos - iSetValuePos - 1);
+        } else {
+            iSet = readGlslDescriptorSet(sCodeLine, iCurrentPos);
+            bindingIndicesInfo.usedGlslSets.insert(iSet);
+        }
         // Check for our special assignment character.
         if (sCodeLine[iCurrentPos] == assignBindingIndexCharacter) {
             bindingIndicesInfo.bFoundBindingIndicesToAssign = true;
+
+            if (bindingIndicesInfo.bShareIndicesBetweenSameResources) {
+                // Remember that this resource will need an index.
+                ReflectedBinding binding{};
+                binding.iSpace = readGlslDescriptorSet(sCodeLine, iCurrentPos);
+                readResourceDeclaration(bParseAsHlsl, sCodeLine, iCurrentPos, binding);
+                if (!binding.sResourceName.empty()) {
+                    bindingIndicesInfo.resourcesToAssign.insert(getResourceKey(binding));
+                }
+            }
+
             return {};
         }
 
@@ -967,7 +4408,24 @@ std::optional<std::string> CombinedShaderLanguageParser::addHardcodedBindingInde
         // hidden behind #ifdef which we don't expand.
 
         // Add index as used.
-        bindingIndicesInfo.usedGlslIndices.insert(iHardcodedBindingIndex);
+        if (bindingIndicesInfo.bTrackGlslIndicesPerSet && optionalSetGroupName.has_value()) {
+            // Will be marked as used once the set is assigned.
+            bindingIndicesInfo.vHardcodedGlslIndicesInGroups.emplace_back(
+                std::move(optionalSetGroupName.value()), iHardcodedBindingIndex);
+        } else {
+            bindingIndicesInfo.getUsedGlslIndices(iSet).markUsed(iHardcodedBindingIndex);
+        }
+
+        if (bindingIndicesInfo.bShareIndicesBetweenSameResources) {
+            // Remember which resource uses this index.
+            ReflectedBinding binding{};
+            binding.iSpace = readGlslDescriptorSet(sCodeLine, iCurrentPos);
+            readResourceDeclaration(bParseAsHlsl, sCodeLine, iCurrentPos, binding);
+            if (!binding.sResourceName.empty()) {
+                bindingIndicesInfo.resourceBindingIndices.emplace(
+                    getResourceKey(binding), iHardcodedBindingIndex);
+            }
+        }
 
         return {};
     });
@@ -1016,6 +4474,16 @@ void CombinedShaderLanguageParser::replaceKeyword(
             }
         }
 
+        // Maybe the keyword is a beginning of some other name (for example `half` in `halfSize`).
+        const auto iNextCharPos = iCurrentPosition + sReplaceFrom.size();
+        if (iNextCharPos < sText.size() &&
+            std::isalnum(static_cast<unsigned char>(sReplaceFrom.back())) != 0 &&
+            (std::isalnum(static_cast<unsigned char>(sText[iNextCharPos])) != 0 ||
+             sText[iNextCharPos] == '_')) {
+            iCurrentPosition += 1;
+            continue;
+        }
+
         // Erase old text.
         sText.erase(iCurrentPosition, sReplaceFrom.size());
 
@@ -1027,7 +4495,8 @@ void CombinedShaderLanguageParser::replaceKeyword(
     } while (iCurrentPosition < sText.size());
 }
 
-std::optional<std::string> CombinedShaderLanguageParser::replaceHlslMulToGlsl(std::string& sHlslCode) {
+std::optional<std::string>
+CombinedShaderLanguageParser::replaceHlslMulToGlsl(std::string& sHlslCode, bool bSwapOperands) {
     size_t iCurrentPosition = 0;
 
     const auto iCommentStartPos = sHlslCode.find("//");
@@ -1063,6 +4532,24 @@ std::optional<std::string> CombinedShaderLanguageParser::replaceHlslMulToGlsl(st
             continue;
         }
 
+        if (bSwapOperands) {
+            // Swap operands so that the next step creates `(b* a)`.
+            const auto iArgumentsPos = iCurrentPosition + 4;
+            const auto iClosePos = findClosingParenthesis(sHlslCode, iArgumentsPos);
+            if (iClosePos == std::string::npos) [[unlikely]] {
+                return std::format(
+                    "found mismatch between the number brackets '(' and ')' in line \"{}\"", sHlslCode);
+            }
+            const auto vArguments = splitFunctionArguments(
+                std::string_view(sHlslCode).substr(iArgumentsPos, iClosePos - iArgumentsPos));
+            if (vArguments.size() == 2) {
+                sHlslCode.replace(
+                    iArgumentsPos,
+                    iClosePos - iArgumentsPos,
+                    std::format("{}, {}", vArguments[1], vArguments[0]));
+            }
+        }
+
         // Erase keyword.
         sHlslCode.erase(iCurrentPosition, 3);
 
@@ -1208,35 +4695,42 @@ CombinedShaderLanguageParser::findIncludePath(
 std::optional<CombinedShaderLanguageParser::Error> CombinedShaderLanguageParser::finalizeParsingResults(
     const std::filesystem::path& pathToShaderSourceFile,
     bool bParseAsHlsl,
+    const ParseOptions& options,
     BindingIndicesInfo& bindingIndicesInfo,
-    std::string& sFullParsedSourceCode,
     std::vector<std::string>& vAdditionalShaderConstants,
-    unsigned int iBaseAutomaticBindingIndex) {
+    ParseResult& parseResult) {
+    auto& sFullParsedSourceCode = parseResult.sFullSourceCode;
+
 #if defined(ENABLE_ADDITIONAL_SHADER_CONSTANTS_KEYWORD)
     // Now insert additional shader constants.
     if (!vAdditionalShaderConstants.empty()) {
-        // Find where push constants start.
-        size_t iShaderConstantsStartPos = 0;
-        if (bParseAsHlsl) {
-            iShaderConstantsStartPos = sFullParsedSourceCode.find("struct RootConstants");
-        } else {
-            iShaderConstantsStartPos = sFullParsedSourceCode.find("layout(push_constant)");
-        }
-        if (iShaderConstantsStartPos == std::string::npos) [[unlikely]] {
+        // Find where push constants are.
+        const auto optionalShaderConstantsBody = findShaderConstantsBody(bParseAsHlsl, sFullParsedSourceCode);
+        if (!optionalShaderConstantsBody.has_value()) [[unlikely]] {
             return Error(
                 "additional push constants were found and includes of the file were processed "
-                "but initial push constants layout was not found in the included files",
-                sFullParsedSourceCode);
+                "but initial push constants layout was not found in the included files (or it has no "
+                "closing bracket)",
+                pathToShaderSourceFile);
         }
+        const size_t iAdditionalShaderConstantsInsertPos = optionalShaderConstantsBody->second;
 
-        // Look for '}' after shader constants.
-        const auto iShaderConstantsEndPos = sFullParsedSourceCode.find('}', iShaderConstantsStartPos);
-        if (iShaderConstantsEndPos == std::string::npos) [[unlikely]] {
-            return Error(
-                "expected to find a closing bracket after push constants definition", pathToShaderSourceFile);
-        }
+        if (options.bReorderAdditionalShaderConstants) {
+            // Find where initial push constants end.
+            auto layoutResult = computeShaderConstantsLayout(bParseAsHlsl, sFullParsedSourceCode);
+            if (std::holds_alternative<std::string>(layoutResult)) [[unlikely]] {
+                return Error(std::get<std::string>(std::move(layoutResult)), pathToShaderSourceFile);
+            }
+            const auto iInitialSize =
+                std::get<std::optional<ShaderConstantsLayout>>(layoutResult).value().iTotalSize;
 
-        const size_t iAdditionalShaderConstantsInsertPos = iShaderConstantsEndPos;
+            // Reorder.
+            auto optionalError =
+                reorderAdditionalShaderConstants(bParseAsHlsl, iInitialSize, vAdditionalShaderConstants);
+            if (optionalError.has_value()) [[unlikely]] {
+                return Error(optionalError.value(), pathToShaderSourceFile);
+            }
+        }
 
         // Insert additional push constants (insert in reserve order because of how `std::string::insert`
         // below works, to make the resulting order is correct).
@@ -1252,16 +4746,109 @@ std::optional<CombinedShaderLanguageParser::Error> CombinedShaderLanguageParser:
     }
 #endif
 
+    const auto bExportDescriptorLayout = !options.pathToDescriptorLayoutFile.empty();
+    if (options.bComputeShaderConstantsLayout || options.bReorderAdditionalShaderConstants ||
+        bExportDescriptorLayout) {
+        // Compute layout of push/root constants.
+        auto layoutResult = computeShaderConstantsLayout(bParseAsHlsl, sFullParsedSourceCode);
+        if (std::holds_alternative<std::string>(layoutResult)) [[unlikely]] {
+            return Error(std::get<std::string>(std::move(layoutResult)), pathToShaderSourceFile);
+        }
+        parseResult.optionalShaderConstantsLayout =
+            std::get<std::optional<ShaderConstantsLayout>>(std::move(layoutResult));
+
+        // Check budget.
+        const auto& optionalLayout = parseResult.optionalShaderConstantsLayout;
+        if (optionalLayout.has_value() && options.iShaderConstantsSizeBudget != 0 &&
+            optionalLayout->iTotalSize > options.iShaderConstantsSizeBudget) {
+            auto sMessage = std::format(
+                "{} constants size {} bytes exceeds the budget of {} bytes",
+                bParseAsHlsl ? "root" : "push",
+                optionalLayout->iTotalSize,
+                options.iShaderConstantsSizeBudget);
+            if (options.bFailIfShaderConstantsExceedBudget) {
+                return Error(sMessage, pathToShaderSourceFile);
+            }
+            parseResult.vWarnings.push_back(std::move(sMessage));
+        }
+    }
+
 #if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
-    if (bindingIndicesInfo.bFoundBindingIndicesToAssign) {
-        // Assign binding indices.
+    if (bindingIndicesInfo.bFoundSpacesToAssign) {
+        // Assign sets/spaces first because binding indices depend on them.
+        auto optionalError = assignRegisterSpaces(
+            bParseAsHlsl, sFullParsedSourceCode, bindingIndicesInfo, options.vSpaceGroupOrder);
+        if (optionalError.has_value()) [[unlikely]] {
+            return Error(optionalError.value(), pathToShaderSourceFile);
+        }
+    }
+
+    const auto bUseBindingLockFile = !options.pathToBindingLockFile.empty();
+    const auto bCollectBindings = options.bCollectBindingReflection || bUseBindingLockFile ||
+                                  bExportDescriptorLayout || options.bCompactBindingIndices;
+    if (bindingIndicesInfo.bFoundBindingIndicesToAssign || bCollectBindings) {
+        // Assign binding indices (also collects reflection since it iterates over all bindings anyway).
         auto optionalError = assignBindingIndices(
-            bParseAsHlsl, sFullParsedSourceCode, bindingIndicesInfo, iBaseAutomaticBindingIndex);
+            bParseAsHlsl,
+            sFullParsedSourceCode,
+            bindingIndicesInfo,
+            options.iBaseAutomaticBindingIndex,
+            bCollectBindings ? &parseResult.vBindings : nullptr);
+        if (optionalError.has_value()) [[unlikely]] {
+            return Error(optionalError.value(), pathToShaderSourceFile);
+        }
+    }
+
+    if (options.bCompactBindingIndices && !parseResult.vBindings.empty()) {
+        parseResult.optionalMaxBindingIndex =
+            std::ranges::max(parseResult.vBindings, {}, &ReflectedBinding::iBindingIndex).iBindingIndex;
+    }
+
+    if (bUseBindingLockFile) {
+        // Remember assigned indices.
+        auto optionalError =
+            saveBindingLockFile(options.pathToBindingLockFile, pathToShaderSourceFile, parseResult.vBindings);
+        if (optionalError.has_value()) [[unlikely]] {
+            return optionalError;
+        }
+    }
+
+    if (!bParseAsHlsl) {
+        // Assign locations of shader inputs and outputs.
+        auto optionalError =
+            assignGlslLocations(sFullParsedSourceCode, bindingIndicesInfo, options.vVertexInputOrder);
         if (optionalError.has_value()) [[unlikely]] {
             return Error(optionalError.value(), pathToShaderSourceFile);
         }
     }
+
+    if (bExportDescriptorLayout) {
+        auto optionalError = exportDescriptorLayout(
+            options.pathToDescriptorLayoutFile,
+            options.descriptorLayoutFormat,
+            parseResult.vBindings,
+            parseResult.optionalShaderConstantsLayout);
+        if (optionalError.has_value()) [[unlikely]] {
+            return optionalError;
+        }
+    }
+
+    if (!options.bCollectBindingReflection) {
+        parseResult.vBindings.clear();
+    }
 #endif
 
+    // Texture functions depend on texture declarations of the resulting code.
+    auto optionalTextureError = bParseAsHlsl ? convertGlslTextureFunctionsToHlsl(sFullParsedSourceCode)
+                                             : convertHlslTextureMethodsToGlsl(sFullParsedSourceCode);
+    if (optionalTextureError.has_value()) [[unlikely]] {
+        return Error(optionalTextureError.value(), pathToShaderSourceFile);
+    }
+
+    if (!bParseAsHlsl) {
+        addRequiredGlslExtensions(sFullParsedSourceCode);
+    }
+    addHelperFunctions(bParseAsHlsl, sFullParsedSourceCode);
+
     return {};
 }
@@ -8,6 +8,15 @@
 #include <unordered_set>
 #include <functional>
 #include <optional>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+// Custom.
+#include "SharedIncludeCache.h"
+#include "MemoryIncludeCache.h"
+#include "RemoteParseCache.h"
 
 /** Parser. */
 class CombinedShaderLanguageParser {
@@ -34,189 +43,1228 @@ public:
         std::filesystem::path pathToErrorFile;
     };
 
+    /** Kind of a shader resource (inferred from its declaration). */
+    enum class ShaderResourceKind : uint8_t {
+        UNKNOWN,
+        UNIFORM_BUFFER,           //< `cbuffer`, `ConstantBuffer<T>`, `uniform Block {...}`
+        STORAGE_BUFFER,           //< `StructuredBuffer<T>`, `RWByteAddressBuffer`, `buffer Block {...}`
+        SAMPLED_TEXTURE,          //< `Texture2D`, `texture2D`, `Buffer<T>`
+        STORAGE_TEXTURE,          //< `RWTexture2D<T>`, `image2D`, `RWBuffer<T>`
+        SAMPLER,                  //< `SamplerState`, `sampler`
+        COMBINED_TEXTURE_SAMPLER, //< `sampler2D`
+    };
+
+    /** Format of a descriptor layout file (see @ref ParseOptions::pathToDescriptorLayoutFile). */
+    enum class DescriptorLayoutFormat : uint8_t {
+        JSON,
+        BINARY,
+    };
+
+    /**
+     * Describes how GLSL matrix types are converted to HLSL (see @ref ParseOptions::matrixLayoutConvention).
+     */
+    enum class MatrixLayoutConvention : uint8_t {
+        /**
+         * GLSL `matCxR` (C columns, R rows) is converted to HLSL `floatRxC` (the same matrix, both
+         * languages use column-major memory layout by default), `mul(a, b)` is converted to `a * b`.
+         */
+        COLUMN_MAJOR,
+
+        /**
+         * GLSL `matCxR` is converted to HLSL `floatCxR` (the HLSL matrix is the transpose of the GLSL
+         * matrix, this is how DXC maps HLSL matrices to SPIR-V so data of `row_major` HLSL matrices can
+         * be used in GLSL as is), `mul(a, b)` is converted to `b * a`.
+         */
+        ROW_MAJOR,
+    };
+
+    /** Describes a shader resource binding that was found (hardcoded) or assigned while parsing. */
+    struct ReflectedBinding {
+        /** Name of the resource (for GLSL blocks this is the block name). */
+        std::string sResourceName;
+
+        /** Declaration text that comes before the resource name, for example `Texture2D` or `uniform`. */
+        std::string sDeclaredType;
+
+        /** HLSL register type (`b`, `t`, `s`, `u`), `0` if parsed as GLSL. */
+        char registerType = 0;
+
+        /** HLSL register space or GLSL descriptor set index. */
+        unsigned int iSpace = 0;
+
+        /** Binding index (register index in HLSL). */
+        unsigned int iBindingIndex = 0;
+
+        /** Number of array elements, `1` if not an array and `0` if an unbounded array (`[]`). */
+        unsigned int iArraySize = 1;
+
+        /** Kind of the resource. */
+        ShaderResourceKind resourceKind = ShaderResourceKind::UNKNOWN;
+
+        /** `true` if the index was assigned by the parser (`?` was used), `false` if it was hardcoded. */
+        bool bIsAutoAssigned = false;
+    };
+
+    /** Describes a member of push constants (GLSL) or root constants (HLSL) struct. */
+    struct ShaderConstantsMember {
+        /** Name of the member. */
+        std::string sName;
+
+        /** Type of the member (without array brackets). */
+        std::string sType;
+
+        /** Offset in bytes from the beginning of the struct. */
+        unsigned int iOffset = 0;
+
+        /** Size in bytes (for arrays: size of the whole array). */
+        unsigned int iSize = 0;
+
+        /** Number of elements if the member is an array, `0` otherwise. */
+        unsigned int iArraySize = 0;
+    };
+
+    /** Memory layout of push constants (GLSL, std430 rules) or root constants (HLSL, cbuffer rules). */
+    struct ShaderConstantsLayout {
+        /** Members in the order of declaration. */
+        std::vector<ShaderConstantsMember> vMembers;
+
+        /** Total size in bytes (end of the last member). */
+        unsigned int iTotalSize = 0;
+    };
+
+    /** Groups optional parameters of the parsing process. */
+    struct ParseOptions {
+        /** Paths to directories in which included files can be found. */
+        std::vector<std::filesystem::path> vAdditionalIncludeDirectories;
+
+        /**
+         * Used only if parsing as GLSL. If you use `?` character to ask the parser to specify automatic
+         * free (unused) binding indices, this value will be used as the smallest (starting)
+         * auto-generated binding index counter.
+         */
+        unsigned int iBaseAutomaticBindingIndex = 0;
+
+        /**
+         * `true` to fill @ref ParseResult::vBindings with all resource bindings of the resulting code
+         * (only available if automatic binding indices are enabled).
+         */
+        bool bCollectBindingReflection = false;
+
+        /**
+         * Optional path to a binding lock file (will be created if does not exist). If specified, binding
+         * indices assigned using `?` will be stored in this file (per shader file and resource) and
+         * reused on next parsing so that adding new resources does not change indices of already
+         * existing resources. New resources take the lowest free index and removed resources free
+         * their indices (only available if automatic binding indices are enabled).
+         */
+        std::filesystem::path pathToBindingLockFile;
+
+        /**
+         * Names of groups used in `set = ?name` (GLSL) and `space?name` (HLSL) in the order of
+         * ascending set/space indices, for example `{"frame", "material", "object"}` to put rarely
+         * changing resources into lower sets. Groups that are not specified here are assigned after
+         * specified ones in the order of appearance.
+         */
+        std::vector<std::string> vSpaceGroupOrder;
+
+        /**
+         * Optional path to a file to write descriptor layout of the resulting code to: resource bindings
+         * grouped by descriptor set (GLSL) / register space (HLSL) and push/root constants range, so that
+         * descriptor set layouts / root signatures can be created without shader reflection (only
+         * available if automatic binding indices are enabled). See README for the format description.
+         */
+        std::filesystem::path pathToDescriptorLayoutFile;
+
+        /** Format of @ref pathToDescriptorLayoutFile. */
+        DescriptorLayoutFormat descriptorLayoutFormat = DescriptorLayoutFormat::JSON;
+
+        /**
+         * Names of vertex shader inputs in the order of the vertex buffer layout. Inputs that use
+         * `location = ?` and are specified here receive locations in this order, other inputs with
+         * `location = ?` are assigned after them in the order of declaration (only used for the first
+         * stage of @ref parsePipeline and only available if automatic binding indices are enabled).
+         */
+        std::vector<std::string> vVertexInputOrder;
+
+        /**
+         * `true` to compute memory layout of the resulting push/root constants struct and store it in
+         * @ref ParseResult::optionalShaderConstantsLayout.
+         */
+        bool bComputeShaderConstantsLayout = false;
+
+        /**
+         * Used only if @ref bComputeShaderConstantsLayout is enabled. If not zero and the size of
+         * push/root constants exceeds this value (in bytes, for example 128 which is the minimum
+         * guaranteed by Vulkan) a warning will be added to @ref ParseResult::vWarnings (or an error will
+         * be returned if @ref bFailIfShaderConstantsExceedBudget is enabled).
+         */
+        unsigned int iShaderConstantsSizeBudget = 0;
+
+        /** `true` to return an error if @ref iShaderConstantsSizeBudget is exceeded instead of a warning. */
+        bool bFailIfShaderConstantsExceedBudget = false;
+
+        /**
+         * `true` to reorder additional push/root constants (appended using `#additional_shader_constants`
+         * and similar keywords) by their alignment to minimize padding. Member names are not changed and
+         * the original order is kept if reordering does not make the struct smaller. The resulting layout
+         * is stored in @ref ParseResult::optionalShaderConstantsLayout.
+         *
+         * @remark Comments in additional push/root constants are removed when reordering.
+         */
+        bool bReorderAdditionalShaderConstants = false;
+
+        /**
+         * `true` to track used GLSL binding indices per descriptor set (instead of sharing them between
+         * all sets) so that `binding = ?` takes the lowest free index (starting from
+         * @ref iBaseAutomaticBindingIndex) in its own set. All hardcoded indices of the parsed file (or
+         * of all stages of @ref parsePipeline) are collected before indices are assigned, so gaps left
+         * by hardcoded indices are filled first and assignment follows the order of declaration.
+         * The maximum binding index of the resulting code (over all sets) is stored in
+         * @ref ParseResult::optionalMaxBindingIndex (only available if automatic binding indices are
+         * enabled).
+         *
+         * @remark HLSL registers are always tracked per register type and space.
+         */
+        bool bCompactBindingIndices = false;
+
+        /**
+         * Used only if parsing as HLSL. `true` to convert GLSL 16 bit float types (`float16_t`,
+         * `f16vecN`, `f16matN`) to `min16float` types (relaxed precision, the driver may use 32 bit
+         * math), `false` to convert them to `half` types (strict 16 bit math, requires
+         * `-enable-16bit-types` in DXC).
+         */
+        bool bRelaxedHalfPrecision = false;
+
+        /**
+         * Compute workgroup size values used instead of `?` in `layout(local_size_x = ?, ...) in;`
+         * (GLSL) and `[numthreads(?, ?, ?)]` (HLSL), for example `{{"local_size_x", 64}}`. Keys are
+         * `local_size_x`, `local_size_y` and `local_size_z` (HLSL `numthreads` arguments use the same
+         * keys in this order). If a `?` is used but its value is not specified an error is returned.
+         */
+        std::unordered_map<std::string, unsigned int> workgroupSize;
+
+        /**
+         * Values of specialization constants (`layout(constant_id = N) const T name = V;` in GLSL and
+         * `[[vk::constant_id(N)]] const T name = V;` in HLSL) per constant ID, for example `{{0, "64"}}`.
+         * Specialization constants that have a value here are folded into regular constants
+         * (`static const T name = value;` in HLSL and `const T name = value;` in GLSL) so that the
+         * compiler can fold branches and unroll loops, other specialization constants are converted to
+         * the specialization constant syntax of the resulting language.
+         */
+        std::unordered_map<unsigned int, std::string> specializationConstantValues;
+
+        /**
+         * Defines how matrix types (including non-square `matCxR`) and `mul` are converted so that the
+         * same matrix data can be used by both GLSL and HLSL code.
+         */
+        MatrixLayoutConvention matrixLayoutConvention = MatrixLayoutConvention::COLUMN_MAJOR;
+
+        /**
+         * Optional path to a directory to store a cache of parsed included files in (empty to disable).
+         * The cache is a memory-mapped file that is shared by all processes that use the same directory
+         * (for example build workers) so that each included file is parsed once per host. Entries are
+         * keyed by path and content hash of the included file (including its nested includes) and by
+         * parse options that change the parsed code. See @ref SharedIncludeCache for more information.
+         */
+        std::filesystem::path pathToIncludeCacheDirectory;
+
+        /**
+         * Size (in bytes) of the include cache file (used only when the file does not exist yet). New
+         * entries are not added once the file is full.
+         */
+        size_t iIncludeCacheFileSize = SharedIncludeCache::iDefaultFileSize;
+
+        /**
+         * Optional in-process cache of parsed included files (`nullptr` to disable) that is owned by the
+         * caller and used by all parse calls that receive it (for example in an editor), the cache must
+         * stay valid while parsing. It's checked before the shared cache
+         * (@ref pathToIncludeCacheDirectory) if both are enabled.
+         */
+        MemoryIncludeCache* pMemoryIncludeCache = nullptr;
+
+        /**
+         * Optional cache of parse results shared over the network (`nullptr` to disable), owned by the
+         * caller. Results are keyed by content hashes of the parsed file and all included files and by
+         * parse options so that identical shaders are parsed once per build farm. Only used by
+         * @ref parse, @ref parseHlsl and @ref parseGlsl and only if @ref pathToBindingLockFile and
+         * @ref pathToDescriptorLayoutFile are empty (they depend on or change local files). Errors of the
+         * cache are not parsing errors (see @ref RemoteParseCache::getStatistics).
+         */
+        RemoteParseCache* pRemoteParseCache = nullptr;
+    };
+
+    /** Groups results of the parsing process. */
+    struct ParseResult {
+        /** Full (combined) source code. */
+        std::string sFullSourceCode;
+
+        /**
+         * Resource bindings in the order they appear in @ref sFullSourceCode, only filled if
+         * @ref ParseOptions::bCollectBindingReflection was enabled.
+         */
+        std::vector<ReflectedBinding> vBindings;
+
+        /**
+         * Layout of push/root constants, only specified if @ref ParseOptions::bComputeShaderConstantsLayout
+         * (or @ref ParseOptions::bReorderAdditionalShaderConstants or
+         * @ref ParseOptions::pathToDescriptorLayoutFile) was specified and push/root constants were found.
+         */
+        std::optional<ShaderConstantsLayout> optionalShaderConstantsLayout;
+
+        /** Non-critical issues that were found while parsing. */
+        std::vector<std::string> vWarnings;
+
+        /**
+         * Maximum binding (register) index used in @ref sFullSourceCode over all descriptor sets (all
+         * register types and spaces in HLSL), only specified if @ref ParseOptions::bCompactBindingIndices
+         * was enabled and bindings were found. See @ref vBindings for per-set indices.
+         */
+        std::optional<unsigned int> optionalMaxBindingIndex;
+    };
+
+    /**
+     * Returns hash of the git commit that was used to build this project.
+     *
+     * @return Commit hash.
+     */
+    static constexpr std::string_view getCommitHash() { return CSLP_GIT_COMMIT_HASH; }
+
+    /**
+     * Parses the specified file as HLSL code (`#glsl` blocks are ignored and not included).
+     *
+     * @param pathToShaderSourceFile        Path to the file to process.
+     * @param vAdditionalIncludeDirectories Paths to directories in which included files can be found.
+     *
+     * @return Error if something went wrong, otherwise full (combined) source code.
+     */
+    static std::variant<std::string, Error> parseHlsl(
+        const std::filesystem::path& pathToShaderSourceFile,
+        const std::vector<std::filesystem::path>& vAdditionalIncludeDirectories = {});
+
+    /**
+     * Parses the specified file as GLSL code (`#hlsl` blocks are ignored and not included).
+     *
+     * @param pathToShaderSourceFile        Path to the file to process.
+     * @param iBaseAutomaticBindingIndex    If you use `?` character to ask the parser to specify automatic
+     * free (unused) binding indices, this value will be used as the smallest (starting) auto-generated
+     * binding index counter so that all parser-generated binding indices will be equal or bigger than this
+     * value. Using this index you can (for example) compile your vertex shaders with 0 base index and
+     * fragment shaders with 100 index to guarantee that indices of shaders will be unique to combine
+     * them later together in your renderer.
+     * @param vAdditionalIncludeDirectories Paths to directories in which included files can be found.
+     *
+     * @return Error if something went wrong, otherwise full (combined) source code.
+     */
+    static std::variant<std::string, Error> parseGlsl(
+        const std::filesystem::path& pathToShaderSourceFile,
+        unsigned int iBaseAutomaticBindingIndex = 0,
+        const std::vector<std::filesystem::path>& vAdditionalIncludeDirectories = {});
+
+    /**
+     * Parses the specified file as HLSL or GLSL code using the specified options.
+     *
+     * @param pathToShaderSourceFile Path to the file to process.
+     * @param bParseAsHlsl           `true` to parse as HLSL (`#glsl` blocks are ignored), `false` to parse
+     * as GLSL (`#hlsl` blocks are ignored).
+     * @param options                Optional parameters.
+     *
+     * @return Error if something went wrong, otherwise parsing results.
+     */
+    static std::variant<ParseResult, Error> parse(
+        const std::filesystem::path& pathToShaderSourceFile,
+        bool bParseAsHlsl,
+        const ParseOptions& options);
+
+    /**
+     * Parses all shader stages of a pipeline together so that binding indices are consistent between
+     * stages: resources with the same name and type will use the same binding index in all stages and
+     * all other `?` binding indices will be densely packed (unique in the whole pipeline).
+     *
+     * @param vPathsToShaderStages Paths to files of each shader stage (for example vertex and fragment).
+     * @param bParseAsHlsl         `true` to parse as HLSL, `false` to parse as GLSL.
+     * @param options              Optional parameters (used for all stages).
+     *
+     * @return Error if something went wrong, otherwise parsing results of each stage (in the same order
+     * as the specified paths).
+     */
+    static std::variant<std::vector<ParseResult>, Error> parsePipeline(
+        const std::vector<std::filesystem::path>& vPathsToShaderStages,
+        bool bParseAsHlsl,
+        const ParseOptions& options);
+
+private:
+    /** Set of used binding indices stored as bits (grows on demand, no hashing). */
+    struct BindingIndexSet {
+        /**
+         * Tells if the specified index is marked as used.
+         *
+         * @param iIndex Binding index.
+         *
+         * @return `true` if used, `false` otherwise.
+         */
+        bool isUsed(unsigned int iIndex) const;
+
+        /**
+         * Marks the specified index as used.
+         *
+         * @param iIndex Binding index.
+         *
+         * @return `false` if the index was already marked as used, `true` otherwise.
+         */
+        bool markUsed(unsigned int iIndex);
+
+        /**
+         * Returns the smallest unused index that is equal to or bigger than the specified one.
+         *
+         * @param iStartIndex Index to start looking from.
+         *
+         * @return Unused index.
+         */
+        unsigned int findFreeIndex(unsigned int iStartIndex) const;
+
+        /** Number of binding indices stored in one item of @ref vUsedIndexBits. */
+        static constexpr unsigned int iBitsPerWord = 64;
+
+        /** Each bit tells if a binding index is used. */
+        std::vector<uint64_t> vUsedIndexBits;
+    };
+
+    /** Used binding indices of HLSL registers stored per register type and register space. */
+    struct HlslRegisterIndices {
+        /**
+         * Returns used indices of the specified register type and space (creates an empty set if needed).
+         *
+         * @param registerType Register type, for example `t`.
+         * @param iSpace       Register space.
+         *
+         * @return `nullptr` if the register type does not support automatic binding indices.
+         */
+        BindingIndexSet* getUsedIndices(char registerType, unsigned int iSpace);
+
+        /** Register types that support automatic binding indices. */
+        static constexpr std::array<char, 4> vRegisterTypes = {'t', 's', 'u', 'b'};
+
+        /** Used indices per register type (same order as @ref vRegisterTypes) and register space. */
+        std::array<std::vector<BindingIndexSet>, vRegisterTypes.size()> vUsedIndicesPerSpace;
+    };
+
+    /** Groups next available resource binding index to assign. */
+    struct BindingIndicesInfo {
+        /**
+         * Returns used GLSL binding indices of the specified descriptor set.
+         *
+         * @param iSet Descriptor set.
+         *
+         * @return Indices of the set if @ref bTrackGlslIndicesPerSet is enabled, otherwise
+         * @ref usedGlslIndices.
+         */
+        BindingIndexSet& getUsedGlslIndices(unsigned int iSet);
+
+        /** Used (hardcoded or assigned) binding indices that were found while parsing GLSL code. */
+        BindingIndexSet usedGlslIndices;
+
+        /** Only used if @ref bTrackGlslIndicesPerSet is enabled, used GLSL binding indices per set. */
+        std::vector<BindingIndexSet> vUsedGlslIndicesPerSet;
+
+        /**
+         * Only used if @ref bTrackGlslIndicesPerSet is enabled. Pairs of "group name" (text after
+         * `set = ?`) - "hardcoded binding index" of GLSL bindings whose set is not assigned yet.
+         */
+        std::vector<std::pair<std::string, unsigned int>> vHardcodedGlslIndicesInGroups;
+
+        /** `true` to track GLSL binding indices per set (see @ref ParseOptions::bCompactBindingIndices). */
+        bool bTrackGlslIndicesPerSet = false;
+
+        /** Used (hardcoded or assigned) binding indices that were found while parsing HLSL code. */
+        HlslRegisterIndices usedHlslIndices;
+
+        /** `true` if a special keyword to insert a random free binding index was found, `false` otherwise. */
+        bool bFoundBindingIndicesToAssign = false;
+
+        /**
+         * `true` if resources with the same name and type should use the same binding index (used when
+         * multiple shader stages share this info), `false` otherwise.
+         */
+        bool bShareIndicesBetweenSameResources = false;
+
+        /**
+         * Only used if @ref bShareIndicesBetweenSameResources is enabled.
+         * Stores pairs of "resource key" (see @ref getResourceKey) - "binding index".
+         */
+        std::unordered_map<std::string, unsigned int> resourceBindingIndices;
+
+        /**
+         * Only used if @ref bShareIndicesBetweenSameResources is enabled.
+         * Keys (see @ref getResourceKey) of resources that use `?` to ask for a binding index.
+         */
+        std::unordered_set<std::string> resourcesToAssign;
+
+        /** Used (hardcoded or assigned) descriptor sets that were found while parsing GLSL code. */
+        std::unordered_set<unsigned int> usedGlslSets;
+
+        /** Used (hardcoded or assigned) register spaces that were found while parsing HLSL code. */
+        std::unordered_set<unsigned int> usedHlslSpaces;
+
+        /** Pairs of "group name" (text after `set = ?` or `space?`) - "assigned set/space index". */
+        std::unordered_map<std::string, unsigned int> assignedSpaceGroups;
+
+        /** `true` if `set = ?` or `space?` was found, `false` otherwise. */
+        bool bFoundSpacesToAssign = false;
+
+        /**
+         * Pairs of "output variable name" - "location" of the previously processed shader stage (used to
+         * assign the same locations to inputs of the next stage), empty if no stage was processed yet.
+         */
+        std::optional<std::unordered_map<std::string, unsigned int>> optionalPreviousStageOutputLocations;
+    };
+
+    /** GLSL shader input or output variable declared using `layout(location = ...)`. */
+    struct GlslInterfaceVariable {
+        /** Name of the variable. */
+        std::string sName;
+
+        /** Position of the location value (or `?`) in the source code. */
+        size_t iLocationValuePosition = 0;
+
+        /** Location of the variable (if not assigned yet then `0`). */
+        unsigned int iLocation = 0;
+
+        /** Number of locations that the variable occupies (for example `4` for `mat4`). */
+        unsigned int iLocationCount = 1;
+
+        /** `true` if this is a shader input, `false` if output. */
+        bool bIsInput = false;
+
+        /** `true` if `location = ?` was used, `false` if the location is hardcoded. */
+        bool bIsAutoAssigned = false;
+    };
+
+    /** GLSL subgroup built-in and its HLSL wave equivalent. */
+    struct SubgroupIntrinsic {
+        /** GLSL name (functions include the opening parenthesis), for example `subgroupAdd(`. */
+        std::string_view sGlslName;
+
+        /** HLSL name (functions include the opening parenthesis), for example `WaveActiveSum(`. */
+        std::string_view sHlslName;
+
+        /** GLSL extension that is required to use @ref sGlslName. */
+        std::string_view sGlslExtension;
+    };
+
+    /** GLSL atomic function and its HLSL equivalent. */
+    struct AtomicFunction {
+        /** GLSL name including the opening parenthesis, for example `atomicAdd(`. */
+        std::string_view sGlslName;
+
+        /**
+         * HLSL name including the opening parenthesis, for example `InterlockedAdd(`. Takes the original
+         * value as the last (out) argument.
+         */
+        std::string_view sHlslName;
+
+        /**
+         * HLSL function to use when the original value is not needed, empty if @ref sHlslName always
+         * needs the original value argument.
+         */
+        std::string_view sHlslNameWithoutResult;
+
+        /** Number of arguments of the GLSL function. */
+        size_t iGlslArgumentCount = 0;
+    };
+
+    /** Function that is added to the resulting code to emulate a built-in of the other language. */
+    struct HelperFunction {
+        /** Name of the function including the opening parenthesis, for example `packHalf2x16(`. */
+        std::string_view sName;
+
+        /** Definition of the function. */
+        std::string_view sDefinition;
+    };
+
+    /** GLSL sampler type and its HLSL texture type equivalent. */
+    struct TextureType {
+        /** GLSL type (also used with `i` and `u` prefixes), for example `sampler2D`. */
+        std::string_view sGlslName;
+
+        /** HLSL type, for example `Texture2D`. */
+        std::string_view sHlslName;
+
+        /** Number of texel coordinates (including array layer), `0` if texels can't be loaded. */
+        size_t iCoordinateCount;
+
+        /** `true` if the texture is multisampled (texel loads use a sample index instead of a mip level). */
+        bool bIsMultisampled;
+    };
+
+    /** Form of a GLSL texture sampling function and its HLSL texture method equivalent. */
+    struct TextureFunction {
+        /** GLSL function including the opening parenthesis, for example `textureLod(`. */
+        std::string_view sGlslName;
+
+        /** HLSL method including the dot and the opening parenthesis, for example `.SampleLevel(`. */
+        std::string_view sHlslName;
+
+        /** Number of arguments after the texture (GLSL) or sampler (HLSL), `2` for `uv, lod`. */
+        size_t iArgumentCount;
+
+        /** `true` if the last two arguments are in the reverse order in HLSL (offset and bias). */
+        bool bSwapLastArguments;
+    };
+
+    /** GLSL memory/execution barrier statements and their HLSL equivalent. */
+    struct BarrierFunction {
+        /** GLSL statements, for example `memoryBarrierShared(); barrier();`. */
+        std::string_view sGlslName;
+
+        /** HLSL statement, for example `GroupMemoryBarrierWithGroupSync();`. */
+        std::string_view sHlslName;
+    };
+
+    /** GLSL control flow attribute (`GL_EXT_control_flow_attributes`) and its HLSL equivalent. */
+    struct ControlFlowAttribute {
+        /** GLSL attribute, for example `[[dont_unroll]]`. */
+        std::string_view sGlslName;
+
+        /** HLSL attribute, for example `[loop]`. */
+        std::string_view sHlslName;
+    };
+
+    /** Describes a type that can be used in push/root constants. */
+    struct ShaderConstantType {
+        /** Size of one component in bytes. */
+        unsigned int iComponentSize = 4; // NOLINT: 32 bit scalar
+
+        /** Number of components in a vector (or in a column of a column-major matrix). */
+        unsigned int iComponentCount = 1;
+
+        /** Number of vectors (columns of a column-major matrix), `1` if not a matrix. */
+        unsigned int iVectorCount = 1;
+    };
+
+    /** Declaration of one or more push/root constants members of the same type. */
+    struct ShaderConstantDeclaration {
+        /** Qualifiers written before the type (each followed by a space), for example `row_major `. */
+        std::string sQualifiers;
+
+        /** Type of the members. */
+        ShaderConstantType type;
+
+        /** Declared members (only name, type and array size are specified). */
+        std::vector<ShaderConstantsMember> vMembers;
+    };
+
+    /** Information about a file (and files it includes) that is collected before parsing. */
+    struct ScannedFileInfo {
+        /**
+         * Estimated size of the parsed code of the file and its includes (in bytes), a heuristic used to
+         * avoid most reallocations of the resulting string, not an upper bound.
+         */
+        size_t iEstimatedParsedSize = 0;
+
+        /** Hash of the file content and content of all included files. */
+        uint64_t iContentHash = 0;
+    };
+
+    /** Groups information about files included by the file being parsed and the include cache. */
+    struct IncludeCacheContext {
+        /** Scanned files per normalized path (see @ref scanSourceFile). */
+        std::unordered_map<std::string, ScannedFileInfo> scannedFiles;
+
+        /** Opened shared include cache, `nullptr` if the shared cache is disabled. */
+        std::unique_ptr<SharedIncludeCache> pSharedCache;
+
+        /** Parser version and parse options that change parsed code (part of cache keys). */
+        std::string sOptionsKey;
+
+        /**
+         * If not `nullptr` then code lines that were checked for hardcoded binding indices will be added
+         * here (filled while parsing an included file to store these lines in the cache).
+         */
+        std::vector<std::string>* pRecordedBindingLines = nullptr;
+
+        /**
+         * Number of variables generated while converting the parsed file and its included files
+         * (used to make names of generated variables unique in the output).
+         */
+        size_t iGeneratedNameCount = 0;
+    };
+
+    /** Parsed included file that was stored in the include cache. */
+    struct CachedIncludedFile {
+        /** Parsed code of the file. */
+        std::string_view sCode;
+
+        /** Additional shader constants that were found in the file. */
+        std::vector<std::string_view> vAdditionalShaderConstants;
+
+        /** Code lines that should be checked for hardcoded binding indices. */
+        std::vector<std::string_view> vBindingLines;
+    };
+
+    /** Binding index that was stored in a binding lock file. */
+    struct LockedBinding {
+        /** Path to the shader file that this binding belongs to. */
+        std::string sShaderPath;
+
+        /** Resource and its binding index. */
+        ReflectedBinding binding;
+    };
+
+    /**
+     * Looks for the specified keyword in the specified line and calls your callback to process code
+     * after keyword (i.e. body).
+     *
+     * @remark Will process various blocks/lines of keyword such as:
+     * @code
+     * #keyword CODE   // single line
+     *
+     * #keyword{       // curly bracket on the same line (block)
+     *     CODE
+     * }
+     *
+     * #keyword        // curly bracket on the next line (block)
+     * {
+     *     CODE
+     * }
+     * @endcode
+     *
+     * @param vKeywords              Different variants of the keyword to look for, for example: `#hlsl`.
+     * @param sLineBuffer            Current line from the file.
+     * @param file                   File to read additional lines if additional push constants were found.
+     * @param pathToShaderSourceFile Path to file being processed.
+     * @param processContent         Callback with text (whole file line or line after keyword) and a keyword
+     * that was found.
+     *
+     * @return Error if something went wrong.
+     */
+    static std::optional<Error> processKeywordCode(
+        const std::vector<std::string_view>& vKeywords,
+        std::string& sLineBuffer,
+        std::ifstream& file,
+        const std::filesystem::path& pathToShaderSourceFile,
+        const std::function<std::optional<Error>(std::string_view sKeyword, std::string& sText)>&
+            processContent);
+
+    /**
+     * Parses a line of code that contains 2 or 3 keywords: HLSL, GLSL and a keyword for both languages,
+     * then triggers a callback on the content of each keyword.
+     *
+     * @param sLineBuffer            Line of code.
+     * @param pathToShaderSourceFile Path to file being processed.
+     * @param processContent         Callback that will be given the code after a keyword
+     * (empty keyword means that there is code before keywords).
+     *
+     * @return `false` if this line does not contain required keywords, `true` if contains and was processed
+     * without errors, otherwise an error.
+     */
+    static std::variant<bool, Error> processMixedLanguageLine(
+        std::string& sLineBuffer,
+        const std::filesystem::path& pathToShaderSourceFile,
+        const std::function<std::optional<Error>(std::string_view sKeyword, std::string& sText)>&
+            processContent);
+
+    /**
+     * Starts parsing using the specified path.
+     *
+     * @param pathToShaderSourceFile Path to the file to process.
+     * @param bParseAsHlsl           Whether to parse as HLSL or as GLSL.
+     * @param options                Optional parameters.
+     *
+     * @return Error if something went wrong, otherwise parsing results.
+     */
+    static std::variant<ParseResult, Error> runParsing(
+        const std::filesystem::path& pathToShaderSourceFile,
+        bool bParseAsHlsl,
+        const ParseOptions& options);
+
+    /**
+     * Scans the specified file and all files it includes (recursively, counted once per include) to
+     * compute content hashes used by caches and to estimate the size of the parsed code (to reserve
+     * the resulting string before parsing). Only used if caches are enabled (see @ref isCacheEnabled).
+     *
+     * @param pathToShaderSourceFile        Path to the file to parse.
+     * @param vAdditionalIncludeDirectories Paths to directories in which included files can be found.
+     * @param scannedFiles                  Already scanned files per normalized path (a file is
+     * stored with zero values while it is being scanned to stop on recursive includes).
+     *
+     * @return Information about the file (errors are ignored, they will be reported while parsing).
+     */
+    static ScannedFileInfo scanSourceFile(
+        const std::filesystem::path& pathToShaderSourceFile,
+        const std::vector<std::filesystem::path>& vAdditionalIncludeDirectories,
+        std::unordered_map<std::string, ScannedFileInfo>& scannedFiles);
+
+    /**
+     * Tells if the specified options enable the include cache (shared or in-process) or the remote parse
+     * cache.
+     *
+     * @param options Optional parameters.
+     *
+     * @return `true` if at least one cache is enabled.
+     */
+    static bool isCacheEnabled(const ParseOptions& options);
+
+    /**
+     * Estimates the size of the parsed code of a file without its includes (see
+     * @ref ScannedFileInfo::iEstimatedParsedSize).
+     *
+     * @param pathToShaderSourceFile Path to the file to parse.
+     *
+     * @return Estimated size in bytes (0 if the size of the file is unknown).
+     */
+    static size_t estimateParsedSize(const std::filesystem::path& pathToShaderSourceFile);
+
+    /**
+     * Opens the shared include cache and prepares keys of cache entries (if include caches are enabled in
+     * the specified options).
+     *
+     * @param bParseAsHlsl Whether to parse as HLSL or as GLSL.
+     * @param options      Optional parameters.
+     * @param context      Context to initialize.
+     *
+     * @return Error message if something went wrong.
+     */
+    static std::optional<std::string>
+    openIncludeCache(bool bParseAsHlsl, const ParseOptions& options, IncludeCacheContext& context);
+
+    /**
+     * Parses an included file or takes its parsed code from include caches (if enabled).
+     *
+     * @remark Hardcoded binding indices and additional shader constants of a cached file are restored
+     * as if the file was parsed.
+     *
+     * @remark Files whose parsed code depends on the code around them (generated variables) are not stored
+     * in caches.
+     *
+     * @param pathToIncludedFile              Path to the included file.
+     * @param bParseAsHlsl                    Whether to parse as HLSL or as GLSL.
+     * @param bindingIndicesInfo              Information about binding indices.
+     * @param vFoundAdditionalShaderConstants Additional shaders constants that were found during parsing.
+     * @param options                         Optional parameters.
+     * @param sFullSourceCode                 Parsed source code of the file will be appended to this
+     * string.
+     * @param includeCache                    Include cache state.
+     *
+     * @return Error if something went wrong.
+     */
+    [[nodiscard]] static std::optional<Error> parseIncludedFile(
+        const std::filesystem::path& pathToIncludedFile,
+        bool bParseAsHlsl,
+        BindingIndicesInfo& bindingIndicesInfo,
+        std::vector<std::string>& vFoundAdditionalShaderConstants,
+        const ParseOptions& options,
+        std::string& sFullSourceCode,
+        IncludeCacheContext& includeCache);
+
+    /**
+     * Creates a key of parse results in the remote parse cache (see @ref ParseOptions::pRemoteParseCache).
+     *
+     * @param options      Optional parameters.
+     * @param sOptionsKey  Parser version and parse options that change parsed code
+     * (see @ref IncludeCacheContext::sOptionsKey).
+     * @param iContentHash Hash of the parsed file and all included files.
+     *
+     * @return Key.
+     */
+    static std::string makeParseResultCacheKey(
+        const ParseOptions& options, const std::string& sOptionsKey, uint64_t iContentHash);
+
+    /**
+     * Serializes parse results to be stored in the remote parse cache.
+     *
+     * @param parseResult Parse results.
+     *
+     * @return Serialized data.
+     */
+    static std::string serializeParseResult(const ParseResult& parseResult);
+
+    /**
+     * Deserializes data created by @ref serializeParseResult.
+     *
+     * @param sData Serialized data.
+     *
+     * @return Empty if the data is damaged, otherwise parse results.
+     */
+    static std::optional<ParseResult> deserializeParseResult(std::string_view sData);
+
+    /**
+     * Serializes a parsed included file to be stored in the include cache.
+     *
+     * @param sCode                      Parsed code of the file.
+     * @param vAdditionalShaderConstants Additional shader constants found in the file.
+     * @param vBindingLines              Code lines that were checked for hardcoded binding indices.
+     *
+     * @return Serialized data.
+     */
+    static std::string serializeCachedIncludedFile(
+        std::string_view sCode,
+        std::span<const std::string> vAdditionalShaderConstants,
+        std::span<const std::string> vBindingLines);
+
+    /**
+     * Deserializes data created by @ref serializeCachedIncludedFile.
+     *
+     * @param sData Serialized data.
+     *
+     * @return Empty if the data is damaged, otherwise deserialized file (references the specified data).
+     */
+    static std::optional<CachedIncludedFile> deserializeCachedIncludedFile(std::string_view sData);
+
+    /**
+     * Parses the specified file.
+     *
+     * @remark Included files are parsed directly into @p sFullSourceCode (instead of returning their
+     * code to the caller) so that included code is not copied once per nesting level.
+     *
+     * @param pathToShaderSourceFile          Path to the file to parseFile.
+     * @param bParseAsHlsl                    Whether to parseFile as HLSL or as GLSL.
+     * @param bindingIndicesInfo              Information about binding indices.
+     * @param vFoundAdditionalShaderConstants Additional shaders constants that were found during parsing.
+     * @param options                         Optional parameters.
+     * @param sFullSourceCode                 Parsed source code of the file (and its includes) will be
+     * appended to this string.
+     * @param includeCache                    Include cache state.
+     *
+     * @return Error if something went wrong.
+     */
+    [[nodiscard]] static std::optional<Error> parseFile(
+        const std::filesystem::path& pathToShaderSourceFile,
+        bool bParseAsHlsl,
+        BindingIndicesInfo& bindingIndicesInfo,
+        std::vector<std::string>& vFoundAdditionalShaderConstants,
+        const ParseOptions& options,
+        std::string& sFullSourceCode,
+        IncludeCacheContext& includeCache);
+
+    /**
+     * Called after a file and all of its includes were parsed to do final parsing logic.
+     *
+     * @param pathToShaderSourceFile     Path to the file to parse.
+     * @param bParseAsHlsl               Whether to parse as HLSL or as GLSL.
+     * @param options                    Optional parameters.
+     * @param bindingIndicesInfo         Information about binding indices.
+     * @param vAdditionalShaderConstants Additional push constants that were found during parsing.
+     * @param parseResult                Parsing results that contain parsed source code.
+     *
+     * @return Error if something went wrong.
+     */
+    [[nodiscard]] static std::optional<Error> finalizeParsingResults(
+        const std::filesystem::path& pathToShaderSourceFile,
+        bool bParseAsHlsl,
+        const ParseOptions& options,
+        BindingIndicesInfo& bindingIndicesInfo,
+        std::vector<std::string>& vAdditionalShaderConstants,
+        ParseResult& parseResult);
+
+    /**
+     * Looks for push constants (GLSL) or root constants (HLSL) struct in the specified code.
+     *
+     * @param bParseAsHlsl `true` to look for HLSL root constants, `false` for GLSL push constants.
+     * @param sSourceCode  Source code to look in.
+     *
+     * @return Empty if not found, otherwise position after `{` and position of `}` of the struct.
+     */
+    static std::optional<std::pair<size_t, size_t>>
+    findShaderConstantsBody(bool bParseAsHlsl, const std::string& sSourceCode);
+
+    /**
+     * Computes memory layout of push constants (GLSL, std430 rules) or root constants (HLSL, cbuffer
+     * packing rules) struct.
+     *
+     * @param bParseAsHlsl `true` to compute HLSL root constants, `false` to compute GLSL push constants.
+     * @param sSourceCode  Source code that contains the struct.
+     *
+     * @return Error message if something went wrong, otherwise empty if the struct was not found or its
+     * layout.
+     */
+    static std::variant<std::optional<ShaderConstantsLayout>, std::string>
+    computeShaderConstantsLayout(bool bParseAsHlsl, const std::string& sSourceCode);
+
+    /**
+     * Reads a single push/root constants declaration (for example `uint a, b[2]`).
+     *
+     * @param sDeclaration Declaration without `;` and comments.
+     * @param bParseAsHlsl `true` if the declaration uses HLSL types, `false` if GLSL.
+     *
+     * @return Error message if something went wrong, otherwise empty if the declaration is empty or read
+     * declaration.
+     */
+    static std::variant<std::optional<ShaderConstantDeclaration>, std::string>
+    readShaderConstantDeclaration(std::string_view sDeclaration, bool bParseAsHlsl);
+
+    /**
+     * Calculates offset and size of a push/root constants member that is placed after the specified offset.
+     *
+     * @param iCurrentOffset Offset (in bytes) where the previous member ends.
+     * @param type           Type of the member.
+     * @param bParseAsHlsl   `true` to use HLSL constant buffer packing rules, `false` to use std430 rules.
+     * @param member         Member with the specified array size, its offset and size will be set.
+     */
+    static void placeShaderConstant(
+        unsigned int iCurrentOffset,
+        const ShaderConstantType& type,
+        bool bParseAsHlsl,
+        ShaderConstantsMember& member);
+
+    /**
+     * Removes all `// ...` comments from the specified code.
+     *
+     * @param sCode Code to modify.
+     */
+    static void removeLineComments(std::string& sCode);
+
+#if defined(ENABLE_ADDITIONAL_SHADER_CONSTANTS_KEYWORD)
+    /**
+     * Reorders additional push/root constants to minimize padding (each member will be declared
+     * separately). Does nothing if the new order does not make push/root constants smaller.
+     *
+     * @param bParseAsHlsl               `true` to use HLSL constant buffer packing rules, `false` for std430.
+     * @param iInitialOffset             Offset (in bytes) where the initial push/root constants end.
+     * @param vAdditionalShaderConstants Additional push/root constants to reorder.
+     *
+     * @return Error message if something went wrong.
+     */
+    [[nodiscard]] static std::optional<std::string> reorderAdditionalShaderConstants(
+        bool bParseAsHlsl, unsigned int iInitialOffset, std::vector<std::string>& vAdditionalShaderConstants);
+#endif
+
+    /**
+     * Returns information about the specified push/root constants member type.
+     *
+     * @param sType        Type name, for example `vec3`, `float4x4`, `uint`, `f16vec2` or `half3`.
+     * @param bIsRowMajor  `true` if matrix was declared as `row_major` (only in HLSL).
+     * @param bParseAsHlsl `true` if `sType` is HLSL type (matrix dimensions are rows x columns),
+     * `false` if GLSL (columns x rows).
+     *
+     * @return Empty if the type is not supported, otherwise type info.
+     */
+    static std::optional<ShaderConstantType>
+    getShaderConstantType(std::string_view sType, bool bIsRowMajor, bool bParseAsHlsl);
+
+    /**
+     * Modifies the input string with GLSL types replaced to HLSL types (for example `vec3` to `float3`).
+     *
+     * @param sGlslLine           Line of GLSL code.
+     * @param sPrecedingCode      Already converted code that comes before the line (used to find
+     * declarations of variables).
+     * @param options             Parse options (16 bit float types and matrices depend on them).
+     * @param iGeneratedNameCount Number of variables generated in the current output (used to make
+     * names of generated variables unique, will be incremented).
+     *
+     * @return Error message if something went wrong.
+     */
+    [[nodiscard]] static std::optional<std::string> convertGlslTypesToHlslTypes(
+        std::string& sGlslLine,
+        std::string_view sPrecedingCode,
+        const ParseOptions& options,
+        size_t& iGeneratedNameCount);
+
+    /**
+     * Replaces all calls of the specified function with another function while keeping closing
+     * parentheses balanced, for example `WaveActiveCountBits(x)` to
+     * `subgroupBallotBitCount(subgroupBallot(x))`. Calls that don't close on the same line are not replaced.
+     *
+     * @param sText        Text to modify.
+     * @param sReplaceFrom Function to replace, may contain nested calls (for example `foo(bar(`).
+     * @param sReplaceTo   Function to place instead, may contain nested calls.
+     */
+    static void
+    replaceNestedFunctionCall(std::string& sText, std::string_view sReplaceFrom, std::string_view sReplaceTo);
+
+    /**
+     * Looks for a call of the specified function (the name must not be a part of some other name).
+     *
+     * @param sText      Text to look in.
+     * @param sName      Function name including the opening parenthesis, for example `atomicAdd(`.
+     * @param iStartPos  Position to start looking from.
+     *
+     * @return Position of the name, `std::string::npos` if not found.
+     */
+    static size_t findFunctionCall(const std::string& sText, std::string_view sName, size_t iStartPos);
+
+    /**
+     * Looks for a closing parenthesis that matches an already opened one.
+     *
+     * @param sText     Text to look in.
+     * @param iStartPos Position right after the opening parenthesis.
+     *
+     * @return Position of the closing parenthesis, `std::string::npos` if not found.
+     */
+    static size_t findClosingParenthesis(const std::string& sText, size_t iStartPos);
+
     /**
-     * Returns hash of the git commit that was used to build this project.
+     * Splits arguments of a function call by top-level commas.
      *
-     * @return Commit hash.
+     * @param sArguments Text between parentheses of a function call.
+     *
+     * @return Arguments without surrounding whitespace.
      */
-    static constexpr std::string_view getCommitHash() { return CSLP_GIT_COMMIT_HASH; }
+    static std::vector<std::string> splitFunctionArguments(std::string_view sArguments);
 
     /**
-     * Parses the specified file as HLSL code (`#glsl` blocks are ignored and not included).
+     * Converts GLSL atomic functions to HLSL `Interlocked*` functions. Because HLSL functions return the
+     * original value through an out parameter, statements that use the return value are rewritten:
+     * `x = atomicAdd(a, b);` becomes `InterlockedAdd(a, b, x);` and in other statements the original
+     * value is written to a generated temporary (of the type that the first argument is declared with)
+     * right before the statement. Calls that span multiple lines are left as is. Calls that can't be
+     * moved before the statement without changing the behavior result in an error: calls in
+     * conditionally evaluated operands of `&&`, `||` or `?:`, in `for` loop headers, in conditions of
+     * `while` or `else if` and (unless converted in place) in bodies of control statements without braces.
      *
-     * @param pathToShaderSourceFile        Path to the file to process.
-     * @param vAdditionalIncludeDirectories Paths to directories in which included files can be found.
+     * @param sGlslLine           Line of GLSL code.
+     * @param sPrecedingCode      Already converted code that comes before the line.
+     * @param iGeneratedNameCount Number of variables generated in the current output (will be incremented).
      *
-     * @return Error if something went wrong, otherwise full (combined) source code.
+     * @return Error message if something went wrong.
      */
-    static std::variant<std::string, Error> parseHlsl(
-        const std::filesystem::path& pathToShaderSourceFile,
-        const std::vector<std::filesystem::path>& vAdditionalIncludeDirectories = {});
+    [[nodiscard]] static std::optional<std::string> convertGlslAtomicsToHlsl(
+        std::string& sGlslLine, std::string_view sPrecedingCode, size_t& iGeneratedNameCount);
 
     /**
-     * Parses the specified file as GLSL code (`#hlsl` blocks are ignored and not included).
+     * Looks for the closest declaration of the variable that is passed to an atomic function
+     * (like `int name`, `uint name` or `RWStructuredBuffer<int> name`) to get the type of the value.
      *
-     * @param pathToShaderSourceFile        Path to the file to process.
-     * @param iBaseAutomaticBindingIndex    If you use `?` character to ask the parser to specify automatic
-     * free (unused) binding indices, this value will be used as the smallest (starting) auto-generated
-     * binding index counter so that all parser-generated binding indices will be equal or bigger than this
-     * value. Using this index you can (for example) compile your vertex shaders with 0 base index and
-     * fragment shaders with 100 index to guarantee that indices of shaders will be unique to combine
-     * them later together in your renderer.
-     * @param vAdditionalIncludeDirectories Paths to directories in which included files can be found.
+     * @param sFirstArgument First argument of an atomic function (for example `data.counters[id]`).
+     * @param sPrecedingCode Code to look for the declaration in.
      *
-     * @return Error if something went wrong, otherwise full (combined) source code.
+     * @return Empty if not found, otherwise `int` or `uint`.
      */
-    static std::variant<std::string, Error> parseGlsl(
-        const std::filesystem::path& pathToShaderSourceFile,
-        unsigned int iBaseAutomaticBindingIndex = 0,
-        const std::vector<std::filesystem::path>& vAdditionalIncludeDirectories = {});
-
-private:
-    /** Groups next available resource binding index to assign. */
-    struct BindingIndicesInfo {
-        /** Used (hardcoded) binding indices that were found while parsing existing GLSL code. */
-        std::unordered_set<unsigned int> usedGlslIndices;
-
-        /**
-         * Used (hardcoded) binding indices that were found while parsing existing HLSL code.
-         * Stores pairs of "register type" - ["register space" - "used binding indices"].
-         */
-        std::unordered_map<char, std::unordered_map<unsigned int, std::unordered_set<unsigned int>>>
-            usedHlslIndices;
+    static std::optional<std::string_view>
+    findAtomicValueType(std::string_view sFirstArgument, std::string_view sPrecedingCode);
 
-        /** `true` if a special keyword to insert a random free binding index was found, `false` otherwise. */
-        bool bFoundBindingIndicesToAssign = false;
-    };
+    /**
+     * Tells if the last code line (ignoring empty lines, comments and preprocessor directives) ends
+     * a statement or a block so that the next line starts a new statement.
+     *
+     * @param sPrecedingCode Code to check.
+     *
+     * @return `true` if the next line starts a new statement (or there is no code).
+     */
+    static bool isAfterStatementEnd(std::string_view sPrecedingCode);
 
     /**
-     * Looks for the specified keyword in the specified line and calls your callback to process code
-     * after keyword (i.e. body).
+     * Converts HLSL `Interlocked*` functions to GLSL atomic functions, for example
+     * `InterlockedAdd(a, b, x);` to `x = atomicAdd(a, b);`.
      *
-     * @remark Will process various blocks/lines of keyword such as:
-     * @code
-     * #keyword CODE   // single line
+     * @param sHlslLine Line of HLSL code.
+     */
+    static void convertHlslAtomicsToGlsl(std::string& sHlslLine);
+
+    /**
+     * Converts compute workgroup size declaration `layout(local_size_x = X, ...) in;` (GLSL) to
+     * `[numthreads(X, Y, Z)]` (HLSL) and back (if the line contains one) and replaces `?` values with
+     * values from @ref ParseOptions::workgroupSize. Because an HLSL attribute applies to the next
+     * declaration, a converted GLSL declaration is removed from the line and returned to be placed
+     * right before the `main` function.
      *
-     * #keyword{       // curly bracket on the same line (block)
-     *     CODE
-     * }
+     * @param bParseAsHlsl        `true` if the resulting code is HLSL, `false` if GLSL.
+     * @param sLine               Line of code.
+     * @param workgroupSize       Values to use instead of `?`.
+     * @param sPendingNumThreads  `[numthreads(X, Y, Z)]` converted from GLSL that was not placed yet
+     * (empty if none), will be set if the line contains a GLSL declaration.
      *
-     * #keyword        // curly bracket on the next line (block)
-     * {
-     *     CODE
-     * }
-     * @endcode
+     * @return Error message if something went wrong.
+     */
+    [[nodiscard]] static std::optional<std::string> convertWorkgroupSize(
+        bool bParseAsHlsl,
+        std::string& sLine,
+        const std::unordered_map<std::string, unsigned int>& workgroupSize,
+        std::string& sPendingNumThreads);
+
+    /**
+     * Converts specialization constant declaration `layout(constant_id = N) const T name = V;` (GLSL) to
+     * `[[vk::constant_id(N)]] const T name = V;` (HLSL) and back (if the line contains one) or folds it
+     * into a regular constant if its value is specified in
+     * @ref ParseOptions::specializationConstantValues.
      *
-     * @param vKeywords              Different variants of the keyword to look for, for example: `#hlsl`.
-     * @param sLineBuffer            Current line from the file.
-     * @param file                   File to read additional lines if additional push constants were found.
-     * @param pathToShaderSourceFile Path to file being processed.
-     * @param processContent         Callback with text (whole file line or line after keyword) and a keyword
-     * that was found.
+     * @param bParseAsHlsl `true` if the resulting code is HLSL, `false` if GLSL.
+     * @param sLine        Line of code.
+     * @param values       Values of specialization constants per constant ID.
      *
-     * @return Error if something went wrong.
+     * @return Error message if something went wrong.
      */
-    static std::optional<Error> processKeywordCode(
-        const std::vector<std::string_view>& vKeywords,
-        std::string& sLineBuffer,
-        std::ifstream& file,
-        const std::filesystem::path& pathToShaderSourceFile,
-        const std::function<std::optional<Error>(std::string_view sKeyword, std::string& sText)>&
-            processContent);
+    [[nodiscard]] static std::optional<std::string> convertSpecializationConstant(
+        bool bParseAsHlsl, std::string& sLine, const std::unordered_map<unsigned int, std::string>& values);
 
     /**
-     * Parses a line of code that contains 2 or 3 keywords: HLSL, GLSL and a keyword for both languages,
-     * then triggers a callback on the content of each keyword.
+     * Converts control flow attributes (loop and branch hints) of the other language, for example
+     * `[loop]` (HLSL) to `[[dont_unroll]]` (GLSL). Attributes are only converted if they are followed
+     * by a statement they can be applied to (or the end of the line) so that array indexing like
+     * `values[branch]` is not affected.
      *
-     * @param sLineBuffer            Line of code.
-     * @param pathToShaderSourceFile Path to file being processed.
-     * @param processContent         Callback that will be given the code after a keyword
-     * (empty keyword means that there is code before keywords).
+     * @param bParseAsHlsl `true` if the resulting code is HLSL, `false` if GLSL.
+     * @param sLine        Line of code.
+     */
+    static void convertControlFlowAttributes(bool bParseAsHlsl, std::string& sLine);
+
+    /**
+     * Looks for GLSL built-ins and types that require an extension (for example subgroup operations,
+     * 16 bit float types or control flow attributes) and inserts missing `#extension` directives after
+     * `#version` (or at the beginning of the code).
      *
-     * @return `false` if this line does not contain required keywords, `true` if contains and was processed
-     * without errors, otherwise an error.
+     * @param sFullSourceCode Full GLSL source code.
      */
-    static std::variant<bool, Error> processMixedLanguageLine(
-        std::string& sLineBuffer,
-        const std::filesystem::path& pathToShaderSourceFile,
-        const std::function<std::optional<Error>(std::string_view sKeyword, std::string& sText)>&
-            processContent);
+    static void addRequiredGlslExtensions(std::string& sFullSourceCode);
 
     /**
-     * Starts parsing using the specified path.
+     * Looks for texture declarations (GLSL samplers or HLSL textures) in the specified code.
      *
-     * @param pathToShaderSourceFile        Path to the file to process.
-     * @param bParseAsHlsl                  Whether to parse as HLSL or as GLSL.
-     * @param vAdditionalIncludeDirectories Paths to directories in which included files can be found.
-     * @param iBaseAutomaticBindingIndex    Used only if parsing as GLSL. If you use `?` character to ask the
-     * parser to specify automatic free (unused) binding indices, this value will be used as the smallest
-     * (starting) auto-generated binding index counter so that all parser-generated binding indices will be
-     * equal or bigger than this value.
+     * @param bParseAsHlsl    `true` to look for HLSL textures, `false` for GLSL samplers.
+     * @param sFullSourceCode Full source code.
      *
-     * @return Error if something went wrong, otherwise full (combined) source code.
+     * @return Texture name - texture type pairs.
      */
-    static std::variant<std::string, Error> runParsing(
-        const std::filesystem::path& pathToShaderSourceFile,
-        bool bParseAsHlsl,
-        const std::vector<std::filesystem::path>& vAdditionalIncludeDirectories,
-        unsigned int iBaseAutomaticBindingIndex = 0);
+    static std::unordered_map<std::string, const TextureType*>
+    findTextureDeclarations(bool bParseAsHlsl, const std::string& sFullSourceCode);
 
     /**
-     * Parses the specified file.
+     * Converts GLSL texture functions (`texelFetch`, `textureGather`, `texture`, `textureLod`,
+     * `textureGrad`) to HLSL texture methods (`Load`, `GatherRed`/`GatherGreen`/`GatherBlue`/
+     * `GatherAlpha`, `Sample`, `SampleLevel`, `SampleGrad`) for textures declared in the HLSL code
+     * (see @ref vSampleTextureFunctions for supported forms of sampling functions). Since HLSL uses
+     * separate samplers, functions that need a sampler can only be converted if the code declares
+     * exactly one `SamplerState`.
      *
-     * @param pathToShaderSourceFile          Path to the file to parseFile.
-     * @param bParseAsHlsl                    Whether to parseFile as HLSL or as GLSL.
-     * @param bindingIndicesInfo              Information about binding indices.
-     * @param vFoundAdditionalShaderConstants Additional shaders constants that were found during parsing.
-     * @param vAdditionalIncludeDirectories   Paths to directories in which included files can be found.
+     * @param sFullSourceCode Full HLSL source code.
      *
-     * @return Error if something went wrong, otherwise parsed source code.
+     * @return Error message if a call of a declared texture can't be converted.
      */
-    static std::variant<std::string, Error> parseFile(
-        const std::filesystem::path& pathToShaderSourceFile,
-        bool bParseAsHlsl,
-        BindingIndicesInfo& bindingIndicesInfo,
-        std::vector<std::string>& vFoundAdditionalShaderConstants,
-        const std::vector<std::filesystem::path>& vAdditionalIncludeDirectories);
+    [[nodiscard]] static std::optional<std::string>
+    convertGlslTextureFunctionsToHlsl(std::string& sFullSourceCode);
 
     /**
-     * Called after a file and all of its includes were parsed to do final parsing logic.
+     * Converts HLSL texture methods (see @ref convertGlslTextureFunctionsToHlsl) to GLSL texture
+     * functions for textures declared as samplers in the GLSL code (samplers passed to HLSL methods are
+     * removed because GLSL uses combined image samplers).
      *
-     * @param pathToShaderSourceFile     Path to the file to parse.
-     * @param bParseAsHlsl               Whether to parse as HLSL or as GLSL.
-     * @param bindingIndicesInfo         Information about binding indices.
-     * @param sFullParsedSourceCode      Parsed source code.
-     * @param vAdditionalShaderConstants Additional push constants that were found during parsing.
-     * @param iBaseAutomaticBindingIndex Used only if parsing as GLSL. If you use `?` character to ask the
-     * parser to specify automatic free (unused) binding indices, this value will be used as the smallest
-     * (starting) auto-generated binding index counter so that all parser-generated binding indices will be
-     * equal or bigger than this value.
+     * @param sFullSourceCode Full GLSL source code.
      *
-     * @return Error if something went wrong.
+     * @return Error message if a sampling method of a declared texture can't be converted.
      */
-    [[nodiscard]] static std::optional<Error> finalizeParsingResults(
-        const std::filesystem::path& pathToShaderSourceFile,
-        bool bParseAsHlsl,
-        BindingIndicesInfo& bindingIndicesInfo,
-        std::string& sFullParsedSourceCode,
-        std::vector<std::string>& vAdditionalShaderConstants,
-        unsigned int iBaseAutomaticBindingIndex = 0);
+    [[nodiscard]] static std::optional<std::string>
+    convertHlslTextureMethodsToGlsl(std::string& sFullSourceCode);
 
     /**
-     * Modifies the input string with GLSL types replaced to HLSL types (for example `vec3` to `float3`).
+     * Looks for calls of built-ins that don't exist in the target language (for example `packHalf2x16` in
+     * HLSL) and inserts definitions of helper functions that emulate them (only once and only if the
+     * code does not define them already). In GLSL helpers are inserted after `#version` and
+     * `#extension` directives, in HLSL at the beginning of the code.
      *
-     * @param sGlslLine Line of GLSL code.
+     * @param bParseAsHlsl    `true` if the code is HLSL, `false` if GLSL.
+     * @param sFullSourceCode Full source code.
      */
-    static void convertGlslTypesToHlslTypes(std::string& sGlslLine);
+    static void addHelperFunctions(bool bParseAsHlsl, std::string& sFullSourceCode);
 
     /**
      * Modifies the input string with HLSL types replaced to GLSL types (for example `mul` to operator*).
      *
      * @param sHlslLine Line of HLSL code.
+     * @param options   Parse options (matrices depend on them).
      *
      * @return Error if something went wrong.
      */
-    [[nodiscard]] static std::optional<std::string> convertHlslTypesToGlslTypes(std::string& sHlslLine);
+    [[nodiscard]] static std::optional<std::string>
+    convertHlslTypesToGlslTypes(std::string& sHlslLine, const ParseOptions& options);
 
 #if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
     /**
@@ -229,6 +1277,8 @@ private:
      * parser to specify automatic free (unused) binding indices, this value will be used as the smallest
      * (starting) auto-generated binding index counter so that all parser-generated binding indices will be
      * equal or bigger than this value.
+     * @param pReflectedBindings If not `nullptr` all found (hardcoded and assigned) bindings will be
+     * added to this array.
      *
      * @return Error if something went wrong.
      */
@@ -236,7 +1286,215 @@ private:
         bool bParseAsHlsl,
         std::string& sFullSourceCode,
         BindingIndicesInfo& bindingIndicesInfo,
-        unsigned int iBaseAutomaticBindingIndex = 0);
+        unsigned int iBaseAutomaticBindingIndex = 0,
+        std::vector<ReflectedBinding>* pReflectedBindings = nullptr);
+#endif
+
+#if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
+    /**
+     * Looks for a declaration of the resource that uses the binding at the specified position and
+     * fills resource name, declared type, array size and resource kind.
+     *
+     * @param bParseAsHlsl     `true` to treat the specified code as HLSL, `false` as GLSL.
+     * @param sSourceCode      Source code (may contain multiple lines of code).
+     * @param iBindingPosition Position of the binding index (or register type) in the source code.
+     * @param reflectedBinding Binding to fill.
+     */
+    static void readResourceDeclaration(
+        bool bParseAsHlsl,
+        const std::string& sSourceCode,
+        size_t iBindingPosition,
+        ReflectedBinding& reflectedBinding);
+
+    /**
+     * Looks for `layout(location = ...)` shader inputs and outputs in GLSL code.
+     *
+     * @param sSourceCode Source code to look in.
+     * @param vVariables  Found variables in the order of appearance.
+     *
+     * @return Error message if something went wrong.
+     */
+    [[nodiscard]] static std::optional<std::string> findGlslInterfaceVariables(
+        const std::string& sSourceCode, std::vector<GlslInterfaceVariable>& vVariables);
+
+    /**
+     * Replaces `location = ?` of GLSL shader inputs and outputs with free locations. Inputs that have
+     * the same name as an output of the previous shader stage receive the same location, other
+     * variables are densely packed.
+     *
+     * @param sFullSourceCode    GLSL code to modify.
+     * @param bindingIndicesInfo Information about binding indices (stores outputs of the previous stage).
+     * @param vVertexInputOrder  Names of inputs in the order of the vertex buffer layout (only used if
+     * this is the first shader stage).
+     *
+     * @return Error message if something went wrong.
+     */
+    [[nodiscard]] static std::optional<std::string> assignGlslLocations(
+        std::string& sFullSourceCode,
+        BindingIndicesInfo& bindingIndicesInfo,
+        const std::vector<std::string>& vVertexInputOrder);
+
+    /**
+     * Infers kind of the resource from its declared type (and register type in HLSL).
+     *
+     * @param bParseAsHlsl `true` if the resource was declared in HLSL, `false` if in GLSL.
+     * @param binding      Binding with declared type and register type specified.
+     *
+     * @return Kind of the resource.
+     */
+    static ShaderResourceKind inferShaderResourceKind(bool bParseAsHlsl, const ReflectedBinding& binding);
+
+    /**
+     * Writes descriptor layout of a shader to a file.
+     *
+     * JSON format:
+     * @code
+     * {
+     *     "sets": [
+     *         {"set": 0, "bindings": [
+     *             {"binding": 0, "name": "frameData", "kind": "uniform_buffer", "arraySize": 1,
+     *              "register": "b"}
+     *         ]}
+     *     ],
+     *     "pushConstantRanges": [{"offset": 0, "size": 16}]
+     * }
+     * @endcode
+     * where `set` is a descriptor set (GLSL) or a register space (HLSL), `register` is only written for
+     * HLSL and `arraySize` is `0` for unbounded arrays.
+     *
+     * Binary format (all integers are little-endian `uint32`, strings are prefixed with their length):
+     * `"CSLD"`, version, set count, then for each set: set index, binding count, then for each binding:
+     * binding index, kind (@ref ShaderResourceKind), array size, register type (`0` for GLSL), name.
+     * After all sets: push constant range count, then for each range: offset, size.
+     *
+     * @param pathToFile              Path to the file to write (will be overwritten).
+     * @param format                  Format of the file.
+     * @param vBindings               Resource bindings of the shader.
+     * @param optionalShaderConstants Layout of push/root constants (if found).
+     *
+     * @return Error if something went wrong.
+     */
+    [[nodiscard]] static std::optional<Error> exportDescriptorLayout(
+        const std::filesystem::path& pathToFile,
+        DescriptorLayoutFormat format,
+        const std::vector<ReflectedBinding>& vBindings,
+        const std::optional<ShaderConstantsLayout>& optionalShaderConstants);
+
+    /**
+     * Reads binding indices stored in the binding lock file and reserves indices of resources that
+     * still exist in the specified shader so that they will be reused.
+     *
+     * @param pathToBindingLockFile  Path to the binding lock file.
+     * @param pathToShaderSourceFile Path to the shader file being processed.
+     * @param bindingIndicesInfo     Information about binding indices.
+     *
+     * @return Error if something went wrong.
+     */
+    [[nodiscard]] static std::optional<Error> loadBindingLockFile(
+        const std::filesystem::path& pathToBindingLockFile,
+        const std::filesystem::path& pathToShaderSourceFile,
+        BindingIndicesInfo& bindingIndicesInfo);
+
+    /**
+     * Replaces binding indices of the specified shader in the binding lock file with the specified
+     * automatically assigned bindings. Holds a lock of the file `<lock file>.lock` while the binding
+     * lock file is updated so that processes that parse other shaders don't lose their entries.
+     *
+     * @param pathToBindingLockFile  Path to the binding lock file.
+     * @param pathToShaderSourceFile Path to the shader file being processed.
+     * @param vBindings              Bindings of the shader (hardcoded bindings are ignored).
+     *
+     * @return Error if something went wrong.
+     */
+    [[nodiscard]] static std::optional<Error> saveBindingLockFile(
+        const std::filesystem::path& pathToBindingLockFile,
+        const std::filesystem::path& pathToShaderSourceFile,
+        const std::vector<ReflectedBinding>& vBindings);
+
+    /**
+     * Reads all entries of the specified binding lock file.
+     *
+     * @param pathToBindingLockFile Path to the binding lock file.
+     *
+     * @return Error if something went wrong, otherwise stored bindings (empty if the file does not exist).
+     */
+    static std::variant<std::vector<LockedBinding>, Error>
+    readBindingLockFile(const std::filesystem::path& pathToBindingLockFile);
+
+    /**
+     * Returns path to the specified shader that is stored in the binding lock file: relative to the
+     * directory of the lock file (so that it does not depend on the working directory) or absolute if
+     * the shader is on a different drive.
+     *
+     * @param pathToBindingLockFile  Path to the binding lock file.
+     * @param pathToShaderSourceFile Path to the shader file.
+     *
+     * @return Path with `/` separators.
+     */
+    static std::string getBindingLockFileShaderPath(
+        const std::filesystem::path& pathToBindingLockFile,
+        const std::filesystem::path& pathToShaderSourceFile);
+
+    /**
+     * Returns a string that identifies the specified resource (register type, space, type and name).
+     *
+     * @param binding Resource binding.
+     *
+     * @return Resource key.
+     */
+    static std::string getResourceKey(const ReflectedBinding& binding);
+
+    /**
+     * Looks if the specified resource was already assigned a binding index (possibly in other shader
+     * stage).
+     *
+     * @param bindingIndicesInfo Information about binding indices.
+     * @param binding            Resource binding to look for (name and type should be specified).
+     *
+     * @return Empty if not found or not enabled, otherwise binding index of the resource.
+     */
+    static std::optional<unsigned int>
+    findResourceBindingIndex(const BindingIndicesInfo& bindingIndicesInfo, const ReflectedBinding& binding);
+
+    /**
+     * Looks for a qualifier with a value (for example `set = N`) in the GLSL `layout(...)` that contains
+     * the specified position.
+     *
+     * @param sSourceCode       Source code (may contain multiple lines of code).
+     * @param iPositionInLayout Position inside of `layout(...)` in the source code.
+     * @param sQualifier        Name of the qualifier, for example `set`.
+     *
+     * @return `npos` if the qualifier is not specified, otherwise position of its value.
+     */
+    static size_t findGlslLayoutQualifierValue(
+        const std::string& sSourceCode, size_t iPositionInLayout, std::string_view sQualifier);
+
+    /**
+     * Reads a `set = N` qualifier in the GLSL `layout(...)` that contains the specified position.
+     *
+     * @param sSourceCode      Source code (may contain multiple lines of code).
+     * @param iBindingPosition Position of the binding index in the source code.
+     *
+     * @return Descriptor set index (`0` if not specified).
+     */
+    static unsigned int readGlslDescriptorSet(const std::string& sSourceCode, size_t iBindingPosition);
+
+    /**
+     * Replaces all `set = ?group` (GLSL) and `space?group` (HLSL) with free (unused) set/space indices
+     * so that resources of the same group use the same set/space.
+     *
+     * @param bParseAsHlsl       `true` to treat the specified code as HLSL, `false` as GLSL.
+     * @param sFullSourceCode    Full source code (may contain multiple lines) to scan for keywords.
+     * @param bindingIndicesInfo Information about used (hardcoded) sets/spaces.
+     * @param vSpaceGroupOrder   Names of groups in the order of ascending set/space indices.
+     *
+     * @return Error if something went wrong.
+     */
+    [[nodiscard]] static std::optional<std::string> assignRegisterSpaces(
+        bool bParseAsHlsl,
+        std::string& sFullSourceCode,
+        BindingIndicesInfo& bindingIndicesInfo,
+        const std::vector<std::string>& vSpaceGroupOrder);
 #endif
 
 #if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
@@ -313,11 +1571,14 @@ private:
     /**
      * Looks for `mul` in the specified code and replaces it with GLSL operator*.
      *
-     * @param sHlslCode Line of HLSL code.
+     * @param sHlslCode     Line of HLSL code.
+     * @param bSwapOperands `true` to swap operands (`mul(a, b)` to `b * a`) because HLSL matrices are
+     * transposed GLSL matrices (see @ref MatrixLayoutConvention::ROW_MAJOR).
      *
      * @return Error if something went wrong.
      */
-    [[nodiscard]] static std::optional<std::string> replaceHlslMulToGlsl(std::string& sHlslCode);
+    [[nodiscard]] static std::optional<std::string>
+    replaceHlslMulToGlsl(std::string& sHlslCode, bool bSwapOperands);
 
     /**
      * Reads digits from the specified position of the specified string until non-digit character is found.
@@ -354,6 +1615,21 @@ private:
     /** Keyword used to specify code for both GLSL and HLSL languages. */
     static constexpr std::string_view sBothKeyword = "#both";
 
+    /** Text that starts GLSL push constants definition. */
+    static constexpr std::string_view sGlslPushConstantsKeyword = "layout(push_constant)";
+
+    /** Text that starts HLSL root constants definition. */
+    static constexpr std::string_view sHlslRootConstantsKeyword = "struct RootConstants";
+
+    /** Size of a 16 byte register used in HLSL constant buffer packing (and GLSL vec4 alignment). */
+    static constexpr unsigned int iShaderConstantsRegisterSize = 16;
+
+    /** First bytes of a descriptor layout file in binary format. */
+    static constexpr std::string_view sDescriptorLayoutBinaryMagic = "CSLD";
+
+    /** Version of descriptor layout binary format. */
+    static constexpr uint32_t iDescriptorLayoutBinaryVersion = 1;
+
     /** Keyword used to include other files. */
     static constexpr std::string_view sIncludeKeyword = "#include";
 
@@ -363,6 +1639,227 @@ private:
     /** GLSL keyword used to specify shader resource binding index. */
     static constexpr std::string_view sGlslBindingKeyword = "binding";
 
+    /** GLSL keyword used to specify layout qualifiers. */
+    static constexpr std::string_view sGlslLayoutKeyword = "layout(";
+
+    /** GLSL keyword used to specify location of shader inputs and outputs. */
+    static constexpr std::string_view sGlslLocationKeyword = "location";
+
+    /**
+     * GLSL subgroup built-ins and their HLSL wave equivalents (grouped by GLSL extension), used in both
+     * directions. If multiple GLSL built-ins map to the same HLSL function then the first one is used
+     * when converting HLSL to GLSL (`subgroupShuffle` because `subgroupBroadcast` needs a constant lane).
+     */
+    static constexpr std::array vSubgroupIntrinsics = {
+        SubgroupIntrinsic{"subgroupElect()", "WaveIsFirstLane()", "GL_KHR_shader_subgroup_basic"},
+        SubgroupIntrinsic{"gl_SubgroupInvocationID", "WaveGetLaneIndex()", "GL_KHR_shader_subgroup_basic"},
+        SubgroupIntrinsic{"gl_SubgroupSize", "WaveGetLaneCount()", "GL_KHR_shader_subgroup_basic"},
+        SubgroupIntrinsic{"subgroupAll(", "WaveActiveAllTrue(", "GL_KHR_shader_subgroup_vote"},
+        SubgroupIntrinsic{"subgroupAny(", "WaveActiveAnyTrue(", "GL_KHR_shader_subgroup_vote"},
+        SubgroupIntrinsic{"subgroupAllEqual(", "WaveActiveAllEqual(", "GL_KHR_shader_subgroup_vote"},
+        SubgroupIntrinsic{"subgroupAdd(", "WaveActiveSum(", "GL_KHR_shader_subgroup_arithmetic"},
+        SubgroupIntrinsic{"subgroupMul(", "WaveActiveProduct(", "GL_KHR_shader_subgroup_arithmetic"},
+        SubgroupIntrinsic{"subgroupMin(", "WaveActiveMin(", "GL_KHR_shader_subgroup_arithmetic"},
+        SubgroupIntrinsic{"subgroupMax(", "WaveActiveMax(", "GL_KHR_shader_subgroup_arithmetic"},
+        SubgroupIntrinsic{"subgroupAnd(", "WaveActiveBitAnd(", "GL_KHR_shader_subgroup_arithmetic"},
+        SubgroupIntrinsic{"subgroupOr(", "WaveActiveBitOr(", "GL_KHR_shader_subgroup_arithmetic"},
+        SubgroupIntrinsic{"subgroupXor(", "WaveActiveBitXor(", "GL_KHR_shader_subgroup_arithmetic"},
+        SubgroupIntrinsic{"subgroupExclusiveAdd(", "WavePrefixSum(", "GL_KHR_shader_subgroup_arithmetic"},
+        SubgroupIntrinsic{"subgroupExclusiveMul(", "WavePrefixProduct(", "GL_KHR_shader_subgroup_arithmetic"},
+        SubgroupIntrinsic{"subgroupBallot(", "WaveActiveBallot(", "GL_KHR_shader_subgroup_ballot"},
+        SubgroupIntrinsic{"subgroupBroadcastFirst(", "WaveReadLaneFirst(", "GL_KHR_shader_subgroup_ballot"},
+        SubgroupIntrinsic{"subgroupShuffle(", "WaveReadLaneAt(", "GL_KHR_shader_subgroup_shuffle"},
+        SubgroupIntrinsic{"subgroupBroadcast(", "WaveReadLaneAt(", "GL_KHR_shader_subgroup_ballot"},
+        SubgroupIntrinsic{"subgroupQuadBroadcast(", "QuadReadLaneAt(", "GL_KHR_shader_subgroup_quad"},
+        SubgroupIntrinsic{"subgroupQuadSwapHorizontal(", "QuadReadAcrossX(", "GL_KHR_shader_subgroup_quad"},
+        SubgroupIntrinsic{"subgroupQuadSwapVertical(", "QuadReadAcrossY(", "GL_KHR_shader_subgroup_quad"},
+        SubgroupIntrinsic{
+            "subgroupQuadSwapDiagonal(", "QuadReadAcrossDiagonal(", "GL_KHR_shader_subgroup_quad"}};
+
+    /** Same as @ref vSubgroupIntrinsics but for HLSL functions that are composed of multiple GLSL calls. */
+    static constexpr std::array vComposedSubgroupIntrinsics = {
+        SubgroupIntrinsic{
+            "subgroupBallotBitCount(subgroupBallot(",
+            "WaveActiveCountBits(",
+            "GL_KHR_shader_subgroup_ballot"},
+        SubgroupIntrinsic{
+            "subgroupBallotExclusiveBitCount(subgroupBallot(",
+            "WavePrefixCountBits(",
+            "GL_KHR_shader_subgroup_ballot"}};
+
+    /** GLSL atomic functions and their HLSL equivalents. */
+    static constexpr std::array vAtomicFunctions = {
+        AtomicFunction{"atomicAdd(", "InterlockedAdd(", "InterlockedAdd(", 2},
+        AtomicFunction{"atomicAnd(", "InterlockedAnd(", "InterlockedAnd(", 2},
+        AtomicFunction{"atomicOr(", "InterlockedOr(", "InterlockedOr(", 2},
+        AtomicFunction{"atomicXor(", "InterlockedXor(", "InterlockedXor(", 2},
+        AtomicFunction{"atomicMin(", "InterlockedMin(", "InterlockedMin(", 2},
+        AtomicFunction{"atomicMax(", "InterlockedMax(", "InterlockedMax(", 2},
+        AtomicFunction{"atomicExchange(", "InterlockedExchange(", "", 2},
+        AtomicFunction{"atomicCompSwap(", "InterlockedCompareExchange(", "InterlockedCompareStore(", 3}};
+
+    /** GLSL compute workgroup size qualifiers in the order of HLSL `numthreads` arguments. */
+    static constexpr std::array<std::string_view, 3> vGlslWorkgroupSizeQualifiers = {
+        "local_size_x", "local_size_y", "local_size_z"};
+
+    /** HLSL attribute that specifies compute workgroup size. */
+    static constexpr std::string_view sHlslNumThreadsKeyword = "[numthreads(";
+
+    /** GLSL layout qualifier that specifies ID of a specialization constant. */
+    static constexpr std::string_view sGlslConstantIdKeyword = "constant_id";
+
+    /** HLSL attribute that specifies ID of a specialization constant. */
+    static constexpr std::string_view sHlslConstantIdKeyword = "[[vk::constant_id(";
+
+    /** Keywords of control statements that can have a body without braces. */
+    static constexpr std::array<std::string_view, 5> vControlStatementKeywords = {
+        "if", "else", "for", "while", "do"};
+
+    /** Prefix of names of temporary variables generated when converting GLSL atomics to HLSL. */
+    static constexpr std::string_view sAtomicOriginalValuePrefix = "cslAtomicOriginalValue";
+
+    /** HLSL implementations of GLSL packing and bit manipulation built-ins (scalar versions). */
+    static constexpr std::array vHlslHelperFunctions = {
+        HelperFunction{
+            "packHalf2x16(",
+            "uint packHalf2x16(float2 value) { return f32tof16(value.x) | (f32tof16(value.y) << 16); }\n"},
+        HelperFunction{
+            "unpackHalf2x16(",
+            "float2 unpackHalf2x16(uint value) { return float2(f16tof32(value), f16tof32(value >> 16)); }\n"},
+        HelperFunction{
+            "packUnorm2x16(",
+            "uint packUnorm2x16(float2 value) {\n"
+            "    uint2 words = uint2(round(saturate(value) * 65535.0));\n"
+            "    return words.x | (words.y << 16);\n"
+            "}\n"},
+        HelperFunction{
+            "unpackUnorm2x16(",
+            "float2 unpackUnorm2x16(uint value) { return float2(value & 0xFFFF, value >> 16) / 65535.0; }\n"},
+        HelperFunction{
+            "packUnorm4x8(",
+            "uint packUnorm4x8(float4 value) {\n"
+            "    uint4 bytes = uint4(round(saturate(value) * 255.0));\n"
+            "    return bytes.x | (bytes.y << 8) | (bytes.z << 16) | (bytes.w << 24);\n"
+            "}\n"},
+        HelperFunction{
+            "unpackUnorm4x8(",
+            "float4 unpackUnorm4x8(uint value) {\n"
+            "    uint4 bytes = uint4(value, value >> 8, value >> 16, value >> 24) & 0xFF;\n"
+            "    return float4(bytes) / 255.0;\n"
+            "}\n"},
+        HelperFunction{
+            "packSnorm4x8(",
+            "uint packSnorm4x8(float4 value) {\n"
+            "    uint4 bytes = uint4(int4(round(clamp(value, -1.0, 1.0) * 127.0))) & 0xFF;\n"
+            "    return bytes.x | (bytes.y << 8) | (bytes.z << 16) | (bytes.w << 24);\n"
+            "}\n"},
+        HelperFunction{
+            "unpackSnorm4x8(",
+            "float4 unpackSnorm4x8(uint value) {\n"
+            "    int4 bytes = int4(uint4(value << 24, value << 16, value << 8, value)) >> 24;\n"
+            "    return clamp(float4(bytes) / 127.0, -1.0, 1.0);\n"
+            "}\n"},
+        HelperFunction{
+            "bitfieldExtract(",
+            "uint bitfieldExtract(uint value, int offset, int bits) {\n"
+            "    return bits == 0 ? 0 : (value >> offset) & (0xFFFFFFFFu >> (32 - bits));\n"
+            "}\n"
+            "int bitfieldExtract(int value, int offset, int bits) {\n"
+            "    return bits == 0 ? 0 : (value << (32 - bits - offset)) >> (32 - bits);\n"
+            "}\n"},
+        HelperFunction{
+            "bitfieldInsert(",
+            "uint bitfieldInsert(uint base, uint insert, int offset, int bits) {\n"
+            "    uint mask = bits == 0 ? 0 : (0xFFFFFFFFu >> (32 - bits)) << offset;\n"
+            "    return (base & ~mask) | ((insert << offset) & mask);\n"
+            "}\n"}};
+
+    /** GLSL implementations of HLSL packing built-ins. */
+    static constexpr std::array vGlslHelperFunctions = {
+        HelperFunction{
+            "f32tof16(", "uint f32tof16(float value) { return packHalf2x16(vec2(value, 0.0)); }\n"},
+        HelperFunction{"f16tof32(", "float f16tof32(uint value) { return unpackHalf2x16(value).x; }\n"}};
+
+    /** GLSL sampler types and their HLSL texture type equivalents. */
+    static constexpr std::array vTextureTypes = {
+        TextureType{"sampler1D", "Texture1D", 1, false},
+        TextureType{"sampler1DArray", "Texture1DArray", 2, false},
+        TextureType{"sampler2D", "Texture2D", 2, false},
+        TextureType{"sampler2DArray", "Texture2DArray", 3, false},
+        TextureType{"sampler2DMS", "Texture2DMS", 2, true},
+        TextureType{"sampler2DMSArray", "Texture2DMSArray", 3, true},
+        TextureType{"sampler3D", "Texture3D", 3, false},
+        TextureType{"samplerCube", "TextureCube", 0, false},
+        TextureType{"samplerCubeArray", "TextureCubeArray", 0, false}};
+
+    /**
+     * Supported forms of GLSL texture sampling functions and their HLSL equivalents (all take a sampler
+     * in HLSL), the first form of a name is used to find calls of all its forms.
+     */
+    static constexpr std::array vSampleTextureFunctions = {
+        TextureFunction{"texture(", ".Sample(", 1, false},                // uv
+        TextureFunction{"texture(", ".SampleBias(", 2, false},            // uv, bias
+        TextureFunction{"textureOffset(", ".Sample(", 2, false},          // uv, offset
+        TextureFunction{"textureOffset(", ".SampleBias(", 3, true},       // uv, offset, bias
+        TextureFunction{"textureLod(", ".SampleLevel(", 2, false},        // uv, lod
+        TextureFunction{"textureLodOffset(", ".SampleLevel(", 3, false},  // uv, lod, offset
+        TextureFunction{"textureGrad(", ".SampleGrad(", 3, false},        // uv, ddx, ddy
+        TextureFunction{"textureGradOffset(", ".SampleGrad(", 4, false}}; // uv, ddx, ddy, offset
+
+    /** HLSL gather methods in the order of GLSL `textureGather` components. */
+    static constexpr std::array<std::string_view, 4> vHlslGatherMethods = {
+        ".GatherRed(", ".GatherGreen(", ".GatherBlue(", ".GatherAlpha("};
+
+    /**
+     * GLSL barriers and their HLSL equivalents used to convert GLSL to HLSL (longer sequences first).
+     * GLSL `groupMemoryBarrier` orders all memory types so it's converted to `AllMemoryBarrier` (HLSL
+     * `GroupMemoryBarrier` only orders `groupshared` memory) and a single `barrier` to a barrier with
+     * group sync because HLSL has no execution-only barrier.
+     */
+    static constexpr std::array vGlslToHlslBarriers = {
+        BarrierFunction{"memoryBarrierShared(); barrier();", "GroupMemoryBarrierWithGroupSync();"},
+        BarrierFunction{"groupMemoryBarrier(); barrier();", "AllMemoryBarrierWithGroupSync();"},
+        BarrierFunction{
+            "memoryBarrierBuffer(); memoryBarrierImage(); barrier();", "DeviceMemoryBarrierWithGroupSync();"},
+        BarrierFunction{"memoryBarrier(); barrier();", "AllMemoryBarrierWithGroupSync();"},
+        BarrierFunction{"memoryBarrierBuffer(); memoryBarrierImage();", "DeviceMemoryBarrier();"},
+        BarrierFunction{"memoryBarrierShared();", "GroupMemoryBarrier();"},
+        BarrierFunction{"groupMemoryBarrier();", "AllMemoryBarrier();"},
+        BarrierFunction{"memoryBarrierBuffer();", "DeviceMemoryBarrier();"},
+        BarrierFunction{"memoryBarrierImage();", "DeviceMemoryBarrier();"},
+        BarrierFunction{"memoryBarrier();", "AllMemoryBarrier();"},
+        BarrierFunction{"barrier();", "GroupMemoryBarrierWithGroupSync();"}};
+
+    /** HLSL barriers and their GLSL equivalents used to convert HLSL to GLSL. */
+    static constexpr std::array vHlslToGlslBarriers = {
+        BarrierFunction{"memoryBarrierShared(); barrier();", "GroupMemoryBarrierWithGroupSync();"},
+        BarrierFunction{
+            "memoryBarrierBuffer(); memoryBarrierImage(); barrier();", "DeviceMemoryBarrierWithGroupSync();"},
+        BarrierFunction{"memoryBarrier(); barrier();", "AllMemoryBarrierWithGroupSync();"},
+        BarrierFunction{"memoryBarrierShared();", "GroupMemoryBarrier();"},
+        BarrierFunction{"memoryBarrierBuffer(); memoryBarrierImage();", "DeviceMemoryBarrier();"},
+        BarrierFunction{"memoryBarrier();", "AllMemoryBarrier();"}};
+
+    /** GLSL control flow attributes and their HLSL equivalents. */
+    static constexpr std::array vControlFlowAttributes = {
+        ControlFlowAttribute{"[[unroll]]", "[unroll]"},
+        ControlFlowAttribute{"[[dont_unroll]]", "[loop]"},
+        ControlFlowAttribute{"[[flatten]]", "[flatten]"},
+        ControlFlowAttribute{"[[branch]]", "[branch]"}};
+
+    /** HLSL unroll attribute with the number of iterations to unroll, for example `[unroll(4)]`. */
+    static constexpr std::string_view sHlslUnrollCountKeyword = "[unroll(";
+
+    /** GLSL extension that is required to use control flow attributes. */
+    static constexpr std::string_view sGlslControlFlowExtension = "GL_EXT_control_flow_attributes";
+
+    /** GLSL extension that is required to use 16 bit float types. */
+    static constexpr std::string_view sGlslFloat16Extension =
+        "GL_EXT_shader_explicit_arithmetic_types_float16";
+
+    /** GLSL keyword used to specify shader resource descriptor set. */
+    static constexpr std::string_view sGlslSetKeyword = "set";
+
     /** HLSL keyword used to specify shader resource binding index. */
     static constexpr std::string_view sHlslBindingKeyword = "register(";
 
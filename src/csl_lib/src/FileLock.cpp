@@ -0,0 +1,73 @@
+#include "FileLock.h"
+
+// Standard.
+#include <format>
+
+// OS.
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+std::variant<std::unique_ptr<FileLock>, std::string> FileLock::lock(const std::filesystem::path& pathToFile) {
+#if defined(_WIN32)
+    const auto hFile = CreateFileW(
+        pathToFile.c_str(),
+        GENERIC_READ | GENERIC_WRITE,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        nullptr,
+        OPEN_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+    if (hFile == INVALID_HANDLE_VALUE) [[unlikely]] {
+        return std::format("failed to open the file \"{}\", error: {}", pathToFile.string(), GetLastError());
+    }
+    OVERLAPPED overlapped{};
+    if (LockFileEx(hFile, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped) == 0) [[unlikely]] {
+        const auto iError = GetLastError();
+        CloseHandle(hFile);
+        return std::format("failed to lock the file \"{}\", error: {}", pathToFile.string(), iError);
+    }
+    return std::unique_ptr<FileLock>(new FileLock(reinterpret_cast<intptr_t>(hFile))); // NOLINT
+#else
+    const int iFileDescriptor = ::open(pathToFile.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666); // NOLINT
+    if (iFileDescriptor < 0) [[unlikely]] {
+        return std::format("failed to open the file \"{}\", error: {}", pathToFile.string(), errno);
+    }
+    int iResult = 0;
+    do {
+        iResult = flock(iFileDescriptor, LOCK_EX);
+    } while (iResult != 0 && errno == EINTR);
+    if (iResult != 0) [[unlikely]] {
+        const auto iError = errno;
+        close(iFileDescriptor);
+        return std::format("failed to lock the file \"{}\", error: {}", pathToFile.string(), iError);
+    }
+    return std::unique_ptr<FileLock>(new FileLock(iFileDescriptor));
+#endif
+}
+
+FileLock::FileLock(intptr_t iFileHandle) : iFileHandle(iFileHandle) {}
+
+FileLock::~FileLock() {
+#if defined(_WIN32)
+    const auto hFile = reinterpret_cast<HANDLE>(iFileHandle); // NOLINT
+    OVERLAPPED overlapped{};
+    UnlockFileEx(hFile, 0, MAXDWORD, MAXDWORD, &overlapped);
+    CloseHandle(hFile);
+#else
+    const auto iFileDescriptor = static_cast<int>(iFileHandle);
+    flock(iFileDescriptor, LOCK_UN);
+    close(iFileDescriptor);
+#endif
+}
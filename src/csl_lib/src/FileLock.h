@@ -0,0 +1,46 @@
+#pragma once
+
+// Standard.
+#include <filesystem>
+#include <string>
+#include <variant>
+#include <memory>
+#include <cstdint>
+
+/**
+ * Exclusive lock of a file that is shared between processes (and threads), the lock is released when the
+ * object is destroyed. Used to make read-modify-write updates of files that multiple processes can update
+ * at the same time.
+ */
+class FileLock {
+public:
+    FileLock() = delete;
+    FileLock(const FileLock&) = delete;
+    FileLock& operator=(const FileLock&) = delete;
+    FileLock(FileLock&&) = delete;
+    FileLock& operator=(FileLock&&) = delete;
+
+    /** Releases the lock. */
+    ~FileLock();
+
+    /**
+     * Waits until no other process (or thread) holds the lock and locks the file.
+     *
+     * @param pathToFile File to lock (will be created if does not exist), it's not modified and should
+     * not be replaced while locked because the lock belongs to the opened file.
+     *
+     * @return Error message if something went wrong, otherwise acquired lock.
+     */
+    static std::variant<std::unique_ptr<FileLock>, std::string> lock(const std::filesystem::path& pathToFile);
+
+private:
+    /**
+     * Initializes the object.
+     *
+     * @param iFileHandle Handle (Windows) or descriptor of the locked file.
+     */
+    explicit FileLock(intptr_t iFileHandle);
+
+    /** Handle (Windows) or descriptor of the locked file. */
+    intptr_t iFileHandle = 0;
+};
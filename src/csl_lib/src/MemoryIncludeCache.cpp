@@ -0,0 +1,103 @@
+#include "MemoryIncludeCache.h"
+
+// Standard.
+#include <algorithm>
+
+MemoryIncludeCache::MemoryIncludeCache(size_t iMaxSizeInBytes) : iMaxSizeInBytes(iMaxSizeInBytes) {}
+
+std::shared_ptr<const std::string> MemoryIncludeCache::find(const std::string& sKey) {
+    std::scoped_lock guard(mtx);
+
+    const auto it = entryByKey.find(sKey);
+    if (it == entryByKey.end()) {
+        statistics.iMissCount += 1;
+        return nullptr;
+    }
+    statistics.iHitCount += 1;
+
+    // Mark as the most recently used.
+    entries.splice(entries.begin(), entries, it->second);
+
+    return it->second->pValue;
+}
+
+void MemoryIncludeCache::insert(
+    const std::string& sKey, const std::filesystem::path& pathToFile, std::string sValue) {
+    Entry entry{};
+    entry.sKey = sKey;
+    entry.pathToFile = std::filesystem::absolute(pathToFile).lexically_normal();
+    // The key is stored twice (in the entry and in the map).
+    entry.iSizeInBytes = sKey.size() * 2 + sValue.size() + entry.pathToFile.native().size();
+    entry.pValue = std::make_shared<const std::string>(std::move(sValue));
+
+    std::scoped_lock guard(mtx);
+
+    // Remove the old value.
+    const auto it = entryByKey.find(sKey);
+    if (it != entryByKey.end()) {
+        removeEntry(it->second);
+    }
+
+    if (entry.iSizeInBytes > iMaxSizeInBytes) [[unlikely]] {
+        return;
+    }
+
+    // Evict least recently used entries.
+    while (statistics.iSizeInBytes + entry.iSizeInBytes > iMaxSizeInBytes) {
+        removeEntry(std::prev(entries.end()));
+        statistics.iEvictionCount += 1;
+    }
+
+    statistics.iSizeInBytes += entry.iSizeInBytes;
+    statistics.iEntryCount += 1;
+    entries.push_front(std::move(entry));
+    entryByKey[sKey] = entries.begin();
+}
+
+size_t MemoryIncludeCache::purge(const std::filesystem::path& pathPrefix) {
+    // Compare path components (not characters) so that `dir` does not match `directory/file.glsl`.
+    auto pathNormalizedPrefix = std::filesystem::absolute(pathPrefix).lexically_normal();
+    if (!pathNormalizedPrefix.has_filename()) {
+        pathNormalizedPrefix = pathNormalizedPrefix.parent_path(); // remove trailing separator
+    }
+
+    std::scoped_lock guard(mtx);
+
+    size_t iRemovedCount = 0;
+    for (auto it = entries.begin(); it != entries.end();) {
+        const auto nextIt = std::next(it);
+        const auto [prefixIt, pathIt] = std::mismatch(
+            pathNormalizedPrefix.begin(),
+            pathNormalizedPrefix.end(),
+            it->pathToFile.begin(),
+            it->pathToFile.end());
+        if (prefixIt == pathNormalizedPrefix.end()) {
+            removeEntry(it);
+            iRemovedCount += 1;
+        }
+        it = nextIt;
+    }
+
+    return iRemovedCount;
+}
+
+void MemoryIncludeCache::clear() {
+    std::scoped_lock guard(mtx);
+
+    entries.clear();
+    entryByKey.clear();
+    statistics.iSizeInBytes = 0;
+    statistics.iEntryCount = 0;
+}
+
+MemoryIncludeCache::Statistics MemoryIncludeCache::getStatistics() const {
+    std::scoped_lock guard(mtx);
+    return statistics;
+}
+
+void MemoryIncludeCache::removeEntry(std::list<Entry>::iterator entryIt) {
+    statistics.iSizeInBytes -= entryIt->iSizeInBytes;
+    statistics.iEntryCount -= 1;
+    entryByKey.erase(entryIt->sKey);
+    entries.erase(entryIt);
+}
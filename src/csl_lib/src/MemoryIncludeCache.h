@@ -0,0 +1,130 @@
+#pragma once
+
+// Standard.
+#include <filesystem>
+#include <string>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+
+/**
+ * In-process cache of parsed included files with a memory budget: when the budget is exceeded least recently
+ * used entries are evicted. Intended for long-running processes (for example editors) that parse shaders
+ * many times. Can be used by multiple threads at the same time.
+ */
+class MemoryIncludeCache {
+public:
+    /** Usage statistics of the cache. */
+    struct Statistics {
+        /** Size of cached entries (sizes of keys, values and paths in bytes). */
+        size_t iSizeInBytes = 0;
+
+        /** Number of cached entries. */
+        size_t iEntryCount = 0;
+
+        /** Number of @ref find calls that found an entry. */
+        size_t iHitCount = 0;
+
+        /** Number of @ref find calls that did not find an entry. */
+        size_t iMissCount = 0;
+
+        /** Number of entries that were removed to stay in the memory budget. */
+        size_t iEvictionCount = 0;
+    };
+
+    MemoryIncludeCache() = delete;
+
+    /**
+     * Initializes an empty cache.
+     *
+     * @param iMaxSizeInBytes Memory budget of the cache (see @ref Statistics::iSizeInBytes).
+     */
+    explicit MemoryIncludeCache(size_t iMaxSizeInBytes);
+
+    /**
+     * Looks for an entry with the specified key and marks it as the most recently used one.
+     *
+     * @param sKey Key of the entry.
+     *
+     * @return `nullptr` if not found, otherwise value of the entry.
+     */
+    std::shared_ptr<const std::string> find(const std::string& sKey);
+
+    /**
+     * Adds a new entry (replaces the value if an entry with the same key exists) and evicts least recently
+     * used entries if the memory budget is exceeded. Entries that are bigger than the whole budget are
+     * not added.
+     *
+     * @param sKey       Key of the entry.
+     * @param pathToFile Path to the included file that the entry was created from (used by @ref purge).
+     * @param sValue     Value of the entry.
+     */
+    void insert(const std::string& sKey, const std::filesystem::path& pathToFile, std::string sValue);
+
+    /**
+     * Removes entries of files located in the specified directory (or the specified file), for example
+     * after files were changed on the disk (entries of changed files are never used again because the
+     * content hash is a part of the key, but they take memory until evicted).
+     *
+     * @param pathPrefix Path to a directory or a file.
+     *
+     * @return Number of removed entries.
+     */
+    size_t purge(const std::filesystem::path& pathPrefix);
+
+    /** Removes all entries (statistics are not reset). */
+    void clear();
+
+    /**
+     * Returns usage statistics.
+     *
+     * @return Statistics.
+     */
+    Statistics getStatistics() const;
+
+    /**
+     * Returns memory budget of the cache.
+     *
+     * @return Size in bytes.
+     */
+    size_t getMaxSizeInBytes() const { return iMaxSizeInBytes; }
+
+private:
+    /** Cached value. */
+    struct Entry {
+        /** Key of the entry. */
+        std::string sKey;
+
+        /** Absolute normalized path to the file that the entry was created from. */
+        std::filesystem::path pathToFile;
+
+        /** Value of the entry (shared so that it stays valid after eviction). */
+        std::shared_ptr<const std::string> pValue;
+
+        /** Size that the entry adds to @ref Statistics::iSizeInBytes. */
+        size_t iSizeInBytes = 0;
+    };
+
+    /**
+     * Removes the specified entry (the caller must hold @ref mtx).
+     *
+     * @param entryIt Entry to remove.
+     */
+    void removeEntry(std::list<Entry>::iterator entryIt);
+
+    /** Entries from the most recently used to the least recently used one. */
+    std::list<Entry> entries;
+
+    /** Entries per key. */
+    std::unordered_map<std::string, std::list<Entry>::iterator> entryByKey;
+
+    /** Usage statistics. */
+    Statistics statistics;
+
+    /** Memory budget of the cache. */
+    const size_t iMaxSizeInBytes = 0;
+
+    /** Guards all fields. */
+    mutable std::mutex mtx;
+};
@@ -0,0 +1,467 @@
+#include "RemoteParseCache.h"
+
+// Standard.
+#include <format>
+#include <array>
+#include <charconv>
+#include <algorithm>
+#include <cctype>
+#include <tuple>
+
+// Custom.
+#include "SharedIncludeCache.h"
+
+// OS.
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+using SocketHandle = SOCKET;
+static const SocketHandle invalidSocket = INVALID_SOCKET;
+#else
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <unistd.h>
+using SocketHandle = int;
+static constexpr SocketHandle invalidSocket = -1;
+#endif
+
+/** Maximum size of a received HTTP message (to not allocate huge strings because of a broken peer). */
+static constexpr size_t iMaxHttpMessageSize = 256 * 1024 * 1024; // NOLINT
+
+/**
+ * Initializes sockets library (once per process).
+ *
+ * @return `false` if failed.
+ */
+static bool initializeSockets() {
+#if defined(_WIN32)
+    static const bool bInitialized = []() {
+        WSADATA data{};
+        return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+    }();
+    return bInitialized;
+#else
+    return true;
+#endif
+}
+
+/**
+ * Closes the specified socket.
+ *
+ * @param socketHandle Socket to close.
+ */
+static void closeSocket(SocketHandle socketHandle) {
+#if defined(_WIN32)
+    closesocket(socketHandle);
+#else
+    close(socketHandle);
+#endif
+}
+
+/**
+ * Sets send/receive timeouts of the specified socket.
+ *
+ * @param socketHandle      Socket.
+ * @param iTimeoutInSeconds Timeout.
+ */
+static void setSocketTimeouts(SocketHandle socketHandle, unsigned int iTimeoutInSeconds) {
+#if defined(_WIN32)
+    const DWORD iTimeout = iTimeoutInSeconds * 1000; // NOLINT
+    const auto* pTimeout = reinterpret_cast<const char*>(&iTimeout); // NOLINT
+#else
+    timeval timeout{};
+    timeout.tv_sec = static_cast<decltype(timeout.tv_sec)>(iTimeoutInSeconds);
+    const auto* pTimeout = &timeout;
+#endif
+    setsockopt(socketHandle, SOL_SOCKET, SO_RCVTIMEO, pTimeout, sizeof(*pTimeout));
+    setsockopt(socketHandle, SOL_SOCKET, SO_SNDTIMEO, pTimeout, sizeof(*pTimeout));
+#if defined(SO_NOSIGPIPE)
+    const int iEnable = 1;
+    setsockopt(socketHandle, SOL_SOCKET, SO_NOSIGPIPE, &iEnable, sizeof(iEnable));
+#endif
+}
+
+/**
+ * Sends all of the specified data.
+ *
+ * @param socketHandle Connected socket.
+ * @param sData        Data to send.
+ *
+ * @return `false` if failed.
+ */
+static bool sendAll(SocketHandle socketHandle, std::string_view sData) {
+#if defined(MSG_NOSIGNAL)
+    constexpr int iFlags = MSG_NOSIGNAL; // don't terminate the process if the peer closed the connection
+#else
+    constexpr int iFlags = 0;
+#endif
+    while (!sData.empty()) {
+        const auto iChunkSize = std::min<size_t>(sData.size(), 1024 * 1024); // NOLINT
+        const auto iSentSize = send(socketHandle, sData.data(), static_cast<int>(iChunkSize), iFlags);
+        if (iSentSize <= 0) {
+            return false;
+        }
+        sData.remove_prefix(static_cast<size_t>(iSentSize));
+    }
+    return true;
+}
+
+/**
+ * Looks for the end of headers of an HTTP message.
+ *
+ * @param sMessage HTTP message.
+ *
+ * @return Empty if headers are not complete, otherwise position of the message body.
+ */
+static std::optional<size_t> findHttpBodyPosition(std::string_view sMessage) {
+    constexpr std::string_view sHeadersEnd = "\r\n\r\n";
+    const auto iHeadersEndPos = sMessage.find(sHeadersEnd);
+    if (iHeadersEndPos == std::string_view::npos) {
+        return {};
+    }
+    return iHeadersEndPos + sHeadersEnd.size();
+}
+
+/**
+ * Reads value of the `Content-Length` header.
+ *
+ * @param sHeaders Headers of an HTTP message.
+ *
+ * @return `0` if not specified, otherwise value of the header.
+ */
+static size_t readHttpContentLength(std::string_view sHeaders) {
+    std::string sLowercaseHeaders(sHeaders);
+    std::ranges::transform(sLowercaseHeaders, sLowercaseHeaders.begin(), [](char character) {
+        return static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+    });
+
+    constexpr std::string_view sContentLengthHeader = "\r\ncontent-length:";
+    auto iCurrentPos = sLowercaseHeaders.find(sContentLengthHeader);
+    if (iCurrentPos == std::string::npos) {
+        return 0;
+    }
+    iCurrentPos = sLowercaseHeaders.find_first_not_of(' ', iCurrentPos + sContentLengthHeader.size());
+    if (iCurrentPos == std::string::npos) [[unlikely]] {
+        return 0;
+    }
+
+    size_t iContentLength = 0;
+    std::from_chars(
+        sLowercaseHeaders.data() + iCurrentPos, // NOLINT
+        sLowercaseHeaders.data() + sLowercaseHeaders.size(), // NOLINT
+        iContentLength);
+    return iContentLength;
+}
+
+/**
+ * Receives an HTTP message (the body is expected to have `Content-Length` specified).
+ *
+ * @param socketHandle Connected socket.
+ *
+ * @return Empty if failed, otherwise the received message.
+ */
+static std::optional<std::string> receiveHttpMessage(SocketHandle socketHandle) {
+    std::string sMessage;
+    std::array<char, 16384> vBuffer{}; // NOLINT
+    std::optional<size_t> optionalMessageSize;
+
+    while (true) {
+        if (!optionalMessageSize.has_value()) {
+            const auto optionalBodyPos = findHttpBodyPosition(sMessage);
+            if (optionalBodyPos.has_value()) {
+                optionalMessageSize =
+                    optionalBodyPos.value() +
+                    readHttpContentLength(std::string_view(sMessage).substr(0, optionalBodyPos.value()));
+            }
+        }
+        if (optionalMessageSize.has_value() && sMessage.size() >= optionalMessageSize.value()) {
+            sMessage.resize(optionalMessageSize.value());
+            return sMessage;
+        }
+        if (sMessage.size() > iMaxHttpMessageSize ||
+            optionalMessageSize.value_or(0) > iMaxHttpMessageSize) [[unlikely]] {
+            return {};
+        }
+
+        const auto iReceivedSize = recv(socketHandle, vBuffer.data(), static_cast<int>(vBuffer.size()), 0);
+        if (iReceivedSize <= 0) {
+            return {};
+        }
+        sMessage.append(vBuffer.data(), static_cast<size_t>(iReceivedSize));
+    }
+}
+
+RemoteParseCache::RemoteParseCache(std::string sHost, uint16_t iPort, unsigned int iTimeoutInSeconds)
+    : sHost(std::move(sHost)), iPort(iPort), iTimeoutInSeconds(iTimeoutInSeconds) {}
+
+std::string RemoteParseCache::computeKeyHash(std::string_view sKey) {
+    const auto iFirstHash = SharedIncludeCache::computeHash(sKey);
+    const auto iSecondHash = SharedIncludeCache::computeHash(sKey, iFirstHash);
+    return std::format("{:016x}{:016x}", iFirstHash, iSecondHash);
+}
+
+std::variant<std::optional<std::string>, std::string> RemoteParseCache::find(std::string_view sKey) {
+    auto result = sendRequest(std::format(
+        "GET {}{} HTTP/1.1\r\nHost: {}\r\nConnection: close\r\n\r\n",
+        sRequestPathPrefix,
+        computeKeyHash(sKey),
+        sHost));
+    std::scoped_lock guard(mtxStatistics);
+    if (std::holds_alternative<std::string>(result)) [[unlikely]] {
+        statistics.iErrorCount += 1;
+        return std::get<std::string>(std::move(result));
+    }
+    auto [iStatusCode, sBody] = std::get<std::pair<unsigned int, std::string>>(std::move(result));
+
+    constexpr unsigned int iNotFoundStatusCode = 404;
+    if (iStatusCode == iNotFoundStatusCode) {
+        statistics.iMissCount += 1;
+        return std::optional<std::string>{};
+    }
+    constexpr unsigned int iOkStatusCode = 200;
+    if (iStatusCode != iOkStatusCode) [[unlikely]] {
+        statistics.iErrorCount += 1;
+        return std::format("remote parse cache responded with status {}", iStatusCode);
+    }
+
+    // The body starts with the key size and the key (see `store`).
+    const auto iKeySizeEndPos = sBody.find('\n');
+    size_t iKeySize = 0;
+    if (iKeySizeEndPos != std::string::npos) {
+        std::from_chars(sBody.data(), sBody.data() + iKeySizeEndPos, iKeySize); // NOLINT
+    }
+    if (iKeySizeEndPos == std::string::npos || iKeySize != sKey.size() ||
+        std::string_view(sBody).substr(iKeySizeEndPos + 1, iKeySize) != sKey) {
+        // Hash collision or a broken value.
+        statistics.iMissCount += 1;
+        return std::optional<std::string>{};
+    }
+
+    statistics.iHitCount += 1;
+    sBody.erase(0, iKeySizeEndPos + 1 + iKeySize);
+    return std::optional<std::string>{std::move(sBody)};
+}
+
+std::optional<std::string> RemoteParseCache::store(std::string_view sKey, std::string_view sValue) {
+    const auto sBodyPrefix = std::format("{}\n{}", sKey.size(), sKey);
+    auto sRequest = std::format(
+        "PUT {}{} HTTP/1.1\r\nHost: {}\r\nContent-Length: {}\r\nConnection: close\r\n\r\n",
+        sRequestPathPrefix,
+        computeKeyHash(sKey),
+        sHost,
+        sBodyPrefix.size() + sValue.size());
+    sRequest += sBodyPrefix;
+    sRequest += sValue;
+
+    auto result = sendRequest(sRequest);
+    std::scoped_lock guard(mtxStatistics);
+    if (std::holds_alternative<std::string>(result)) [[unlikely]] {
+        statistics.iErrorCount += 1;
+        return std::get<std::string>(std::move(result));
+    }
+    const auto iStatusCode = std::get<std::pair<unsigned int, std::string>>(result).first;
+    constexpr unsigned int iMinSuccessStatusCode = 200;
+    constexpr unsigned int iMaxSuccessStatusCode = 299;
+    if (iStatusCode < iMinSuccessStatusCode || iStatusCode > iMaxSuccessStatusCode) [[unlikely]] {
+        statistics.iErrorCount += 1;
+        return std::format("remote parse cache responded with status {}", iStatusCode);
+    }
+
+    statistics.iStoreCount += 1;
+    return {};
+}
+
+RemoteParseCache::Statistics RemoteParseCache::getStatistics() const {
+    std::scoped_lock guard(mtxStatistics);
+    return statistics;
+}
+
+std::variant<std::pair<unsigned int, std::string>, std::string>
+RemoteParseCache::sendRequest(const std::string& sRequest) {
+    if (!initializeSockets()) [[unlikely]] {
+        return "failed to initialize sockets";
+    }
+
+    // Resolve the address.
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* pAddresses = nullptr;
+    const auto sPort = std::to_string(iPort);
+    if (getaddrinfo(sHost.c_str(), sPort.c_str(), &hints, &pAddresses) != 0) [[unlikely]] {
+        return std::format("failed to resolve remote parse cache address \"{}:{}\"", sHost, iPort);
+    }
+
+    // Connect.
+    SocketHandle socketHandle = invalidSocket;
+    for (auto* pAddress = pAddresses; pAddress != nullptr; pAddress = pAddress->ai_next) {
+        socketHandle = socket(pAddress->ai_family, pAddress->ai_socktype, pAddress->ai_protocol);
+        if (socketHandle == invalidSocket) {
+            continue;
+        }
+        setSocketTimeouts(socketHandle, iTimeoutInSeconds);
+        if (connect(socketHandle, pAddress->ai_addr, static_cast<int>(pAddress->ai_addrlen)) == 0) {
+            break;
+        }
+        closeSocket(socketHandle);
+        socketHandle = invalidSocket;
+    }
+    freeaddrinfo(pAddresses);
+    if (socketHandle == invalidSocket) [[unlikely]] {
+        return std::format("failed to connect to remote parse cache \"{}:{}\"", sHost, iPort);
+    }
+
+    // Send the request and receive the response.
+    std::optional<std::string> optionalResponse;
+    if (sendAll(socketHandle, sRequest)) {
+        optionalResponse = receiveHttpMessage(socketHandle);
+    }
+    closeSocket(socketHandle);
+    if (!optionalResponse.has_value()) [[unlikely]] {
+        return std::format("failed to communicate with remote parse cache \"{}:{}\"", sHost, iPort);
+    }
+    const auto& sResponse = optionalResponse.value();
+
+    // Read status code from the status line (`HTTP/1.1 200 OK`).
+    const auto iStatusCodePos = sResponse.find(' ');
+    unsigned int iStatusCode = 0;
+    if (iStatusCodePos != std::string::npos) {
+        std::from_chars(
+            sResponse.data() + iStatusCodePos + 1, // NOLINT
+            sResponse.data() + sResponse.size(),   // NOLINT
+            iStatusCode);
+    }
+    if (iStatusCode == 0) [[unlikely]] {
+        return std::format("received invalid response from remote parse cache \"{}:{}\"", sHost, iPort);
+    }
+
+    return std::pair<unsigned int, std::string>{
+        iStatusCode, sResponse.substr(findHttpBodyPosition(sResponse).value_or(sResponse.size()))};
+}
+
+std::variant<std::unique_ptr<RemoteParseCacheServer>, std::string>
+RemoteParseCacheServer::start(uint16_t iPort) {
+    if (!initializeSockets()) [[unlikely]] {
+        return "failed to initialize sockets";
+    }
+
+    // Create a socket.
+    const auto listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (listenSocket == invalidSocket) [[unlikely]] {
+        return "failed to create a socket";
+    }
+    const int iEnable = 1;
+    const auto* pEnable = reinterpret_cast<const char*>(&iEnable); // NOLINT
+    setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, pEnable, sizeof(iEnable));
+
+    // Listen on localhost.
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(iPort);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t iAddressSize = sizeof(address);
+    if (bind(listenSocket, reinterpret_cast<sockaddr*>(&address), iAddressSize) != 0 || // NOLINT
+        listen(listenSocket, SOMAXCONN) != 0 ||
+        getsockname(listenSocket, reinterpret_cast<sockaddr*>(&address), &iAddressSize) != 0) // NOLINT
+        [[unlikely]] {
+        closeSocket(listenSocket);
+        return std::format("failed to listen on port {}", iPort);
+    }
+
+    auto pServer = std::unique_ptr<RemoteParseCacheServer>(
+        new RemoteParseCacheServer(static_cast<intptr_t>(listenSocket), ntohs(address.sin_port)));
+    pServer->serverThread = std::thread(&RemoteParseCacheServer::serve, pServer.get());
+
+    return pServer;
+}
+
+RemoteParseCacheServer::RemoteParseCacheServer(intptr_t iListenSocket, uint16_t iPort)
+    : iListenSocket(iListenSocket), iPort(iPort) {}
+
+RemoteParseCacheServer::~RemoteParseCacheServer() {
+    bStop = true;
+
+    // Wake up the server thread that waits for a connection.
+    RemoteParseCache wakeUpClient("127.0.0.1", iPort, 1);
+    std::ignore = wakeUpClient.find("");
+
+    if (serverThread.joinable()) {
+        serverThread.join();
+    }
+    closeSocket(static_cast<SocketHandle>(iListenSocket));
+}
+
+size_t RemoteParseCacheServer::getValueCount() const {
+    std::scoped_lock guard(mtxValues);
+    return values.size();
+}
+
+void RemoteParseCacheServer::serve() {
+    constexpr unsigned int iClientTimeoutInSeconds = 5;
+
+    while (!bStop) {
+        const auto clientSocket = accept(static_cast<SocketHandle>(iListenSocket), nullptr, nullptr);
+        if (clientSocket == invalidSocket) {
+            continue;
+        }
+        if (bStop) {
+            closeSocket(clientSocket);
+            break;
+        }
+
+        // Handle one request per connection.
+        setSocketTimeouts(clientSocket, iClientTimeoutInSeconds);
+        const auto optionalRequest = receiveHttpMessage(clientSocket);
+        if (optionalRequest.has_value()) {
+            sendAll(clientSocket, handleRequest(optionalRequest.value()));
+        }
+        closeSocket(clientSocket);
+    }
+}
+
+std::string RemoteParseCacheServer::handleRequest(const std::string& sRequest) {
+    const auto makeResponse = [](std::string_view sStatus, std::string_view sBody) {
+        return std::format(
+            "HTTP/1.1 {}\r\nContent-Length: {}\r\nConnection: close\r\n\r\n{}", sStatus, sBody.size(), sBody);
+    };
+
+    // Parse the request line (`GET /parse-results/<hash> HTTP/1.1`).
+    const auto iMethodEndPos = sRequest.find(' ');
+    const auto iPathEndPos =
+        iMethodEndPos == std::string::npos ? std::string::npos : sRequest.find(' ', iMethodEndPos + 1);
+    if (iPathEndPos == std::string::npos) [[unlikely]] {
+        return makeResponse("400 Bad Request", "");
+    }
+    const auto sMethod = std::string_view(sRequest).substr(0, iMethodEndPos);
+    const auto sPath = std::string_view(sRequest).substr(iMethodEndPos + 1, iPathEndPos - iMethodEndPos - 1);
+    if (!sPath.starts_with(RemoteParseCache::sRequestPathPrefix)) [[unlikely]] {
+        return makeResponse("404 Not Found", "");
+    }
+    const std::string sKeyHash(sPath.substr(RemoteParseCache::sRequestPathPrefix.size()));
+
+    if (sMethod == "GET") {
+        std::scoped_lock guard(mtxValues);
+        const auto it = values.find(sKeyHash);
+        if (it == values.end()) {
+            return makeResponse("404 Not Found", "");
+        }
+        return makeResponse("200 OK", it->second);
+    }
+
+    if (sMethod == "PUT") {
+        std::scoped_lock guard(mtxValues);
+        values[sKeyHash] = sRequest.substr(findHttpBodyPosition(sRequest).value_or(sRequest.size()));
+        return makeResponse("201 Created", "");
+    }
+
+    return makeResponse("405 Method Not Allowed", "");
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+// Standard.
+#include <string>
+#include <string_view>
+#include <variant>
+#include <optional>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Client of a content-addressed cache of parse results that is shared over the network (for example between
+ * nodes of a build farm).
+ *
+ * Uses a simple HTTP/1.1 protocol (one connection per request):
+ * - `GET /parse-results/<hash>` returns `200` with the stored value or `404` if not found,
+ * - `PUT /parse-results/<hash>` stores the request body and returns `201`.
+ *
+ * `<hash>` is a 128 bit hash of the key (32 hex characters). The key is also stored in the value so that
+ * values of colliding hashes are never used. See @ref RemoteParseCacheServer for a reference server.
+ */
+class RemoteParseCache {
+public:
+    /** Usage statistics of the cache. */
+    struct Statistics {
+        /** Number of @ref find calls that found a value. */
+        size_t iHitCount = 0;
+
+        /** Number of @ref find calls that did not find a value (not including errors). */
+        size_t iMissCount = 0;
+
+        /** Number of values stored using @ref store. */
+        size_t iStoreCount = 0;
+
+        /** Number of failed requests (for example if the server is not available). */
+        size_t iErrorCount = 0;
+    };
+
+    RemoteParseCache() = delete;
+
+    /**
+     * Initializes the client (does not connect to the server).
+     *
+     * @param sHost             Host name or IP address of the server.
+     * @param iPort             Port of the server.
+     * @param iTimeoutInSeconds Maximum time to wait for sending or receiving data.
+     */
+    RemoteParseCache(std::string sHost, uint16_t iPort, unsigned int iTimeoutInSeconds = 5); // NOLINT
+
+    /**
+     * Requests a value from the server.
+     *
+     * @param sKey Key of the value.
+     *
+     * @return Error message if something went wrong, otherwise empty if not found or the value.
+     */
+    std::variant<std::optional<std::string>, std::string> find(std::string_view sKey);
+
+    /**
+     * Sends a value to the server.
+     *
+     * @param sKey   Key of the value.
+     * @param sValue Value to store.
+     *
+     * @return Error message if something went wrong.
+     */
+    std::optional<std::string> store(std::string_view sKey, std::string_view sValue);
+
+    /**
+     * Returns usage statistics.
+     *
+     * @return Statistics.
+     */
+    Statistics getStatistics() const;
+
+    /**
+     * Computes hash of the specified key that is used in requests.
+     *
+     * @param sKey Key of a value.
+     *
+     * @return 32 hex characters.
+     */
+    static std::string computeKeyHash(std::string_view sKey);
+
+    /** Path that is followed by a key hash in requests. */
+    static constexpr std::string_view sRequestPathPrefix = "/parse-results/";
+
+private:
+    /**
+     * Sends a request to the server and waits for the response.
+     *
+     * @param sRequest Full HTTP request.
+     *
+     * @return Error message if something went wrong, otherwise HTTP status code and response body.
+     */
+    std::variant<std::pair<unsigned int, std::string>, std::string> sendRequest(const std::string& sRequest);
+
+    /** Host name or IP address of the server. */
+    std::string sHost;
+
+    /** Port of the server. */
+    uint16_t iPort = 0;
+
+    /** Maximum time to wait for sending or receiving data. */
+    unsigned int iTimeoutInSeconds = 0;
+
+    /** Usage statistics. */
+    Statistics statistics;
+
+    /** Guards @ref statistics. */
+    mutable std::mutex mtxStatistics;
+};
+
+/**
+ * Minimal in-memory server of @ref RemoteParseCache protocol that listens on localhost, intended for
+ * tests and as a reference implementation for real servers.
+ */
+class RemoteParseCacheServer {
+public:
+    RemoteParseCacheServer() = delete;
+    RemoteParseCacheServer(const RemoteParseCacheServer&) = delete;
+    RemoteParseCacheServer& operator=(const RemoteParseCacheServer&) = delete;
+    RemoteParseCacheServer(RemoteParseCacheServer&&) = delete;
+    RemoteParseCacheServer& operator=(RemoteParseCacheServer&&) = delete;
+
+    /** Stops the server. */
+    ~RemoteParseCacheServer();
+
+    /**
+     * Starts listening on `127.0.0.1` and serving requests on a background thread.
+     *
+     * @param iPort Port to listen on, `0` to pick a free port (see @ref getPort).
+     *
+     * @return Error message if something went wrong, otherwise started server.
+     */
+    static std::variant<std::unique_ptr<RemoteParseCacheServer>, std::string> start(uint16_t iPort = 0);
+
+    /**
+     * Returns port that the server listens on.
+     *
+     * @return Port.
+     */
+    uint16_t getPort() const { return iPort; }
+
+    /**
+     * Returns the number of stored values.
+     *
+     * @return Value count.
+     */
+    size_t getValueCount() const;
+
+private:
+    /**
+     * Initializes the object.
+     *
+     * @param iListenSocket Socket that listens for connections.
+     * @param iPort         Port of the socket.
+     */
+    RemoteParseCacheServer(intptr_t iListenSocket, uint16_t iPort);
+
+    /** Accepts connections and handles their requests until stopped. */
+    void serve();
+
+    /**
+     * Handles a request of an accepted connection.
+     *
+     * @param sRequest Received request.
+     *
+     * @return Response to send.
+     */
+    std::string handleRequest(const std::string& sRequest);
+
+    /** Stored values per key hash. */
+    std::unordered_map<std::string, std::string> values;
+
+    /** Guards @ref values. */
+    mutable std::mutex mtxValues;
+
+    /** Thread that runs @ref serve. */
+    std::thread serverThread;
+
+    /** Set to stop @ref serve. */
+    std::atomic<bool> bStop{false};
+
+    /** Socket that listens for connections. */
+    intptr_t iListenSocket = 0;
+
+    /** Port of @ref iListenSocket. */
+    uint16_t iPort = 0;
+};
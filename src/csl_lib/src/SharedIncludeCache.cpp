@@ -0,0 +1,255 @@
+#include "SharedIncludeCache.h"
+
+// Standard.
+#include <atomic>
+#include <cstring>
+#include <format>
+#include <random>
+#include <fstream>
+#include <algorithm>
+#include <limits>
+
+// OS.
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+static_assert(
+    std::atomic_ref<uint64_t>::is_always_lock_free,
+    "lock-free 64 bit atomics are required to share the cache between processes");
+
+std::variant<std::unique_ptr<SharedIncludeCache>, std::string>
+SharedIncludeCache::open(const std::filesystem::path& pathToDirectory, size_t iFileSize) {
+    // Create the directory.
+    std::error_code errorCode;
+    std::filesystem::create_directories(pathToDirectory, errorCode);
+    if (errorCode) [[unlikely]] {
+        return std::format(
+            "failed to create the include cache directory \"{}\", error: {}",
+            pathToDirectory.string(),
+            errorCode.message());
+    }
+
+    // Create the file if it does not exist.
+    const auto pathToFile = pathToDirectory / sCacheFileName;
+    if (!std::filesystem::exists(pathToFile)) {
+        // Create a file of the full size under a temporary name and then link it so that other processes
+        // never see a file of a different size.
+        const auto pathToTemporaryFile =
+            pathToDirectory / std::format("{}.{}.tmp", sCacheFileName, std::random_device{}());
+        {
+            std::ofstream temporaryFile(pathToTemporaryFile, std::ios::binary);
+            if (!temporaryFile.is_open()) [[unlikely]] {
+                return std::format("failed to create the file \"{}\"", pathToTemporaryFile.string());
+            }
+        }
+        std::filesystem::resize_file(pathToTemporaryFile, std::max(iFileSize, iEntriesOffset), errorCode);
+        if (!errorCode) {
+            // Fails if another process created the file first (which is fine).
+            std::filesystem::create_hard_link(pathToTemporaryFile, pathToFile, errorCode);
+        }
+        std::filesystem::remove(pathToTemporaryFile, errorCode);
+    }
+
+    // Get the size of the file (may differ from the specified one if the file was created earlier).
+    const auto iActualFileSize = std::filesystem::file_size(pathToFile, errorCode);
+    if (errorCode) [[unlikely]] {
+        return std::format(
+            "failed to get size of the include cache file \"{}\", error: {}",
+            pathToFile.string(),
+            errorCode.message());
+    }
+    if (iActualFileSize < iEntriesOffset) [[unlikely]] {
+        return std::format(
+            "the include cache file \"{}\" is too small ({} bytes, expected at least {} bytes)",
+            pathToFile.string(),
+            iActualFileSize,
+            iEntriesOffset);
+    }
+
+    // Map the file.
+    std::byte* pMappedFile = nullptr;
+#if defined(_WIN32)
+    const auto hFile = CreateFileW(
+        pathToFile.c_str(),
+        GENERIC_READ | GENERIC_WRITE,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+    if (hFile == INVALID_HANDLE_VALUE) [[unlikely]] {
+        return std::format(
+            "failed to open the include cache file \"{}\", error: {}", pathToFile.string(), GetLastError());
+    }
+    const auto hMapping = CreateFileMappingW(hFile, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+    CloseHandle(hFile);
+    if (hMapping == nullptr) [[unlikely]] {
+        return std::format(
+            "failed to map the include cache file \"{}\", error: {}", pathToFile.string(), GetLastError());
+    }
+    pMappedFile = static_cast<std::byte*>(MapViewOfFile(hMapping, FILE_MAP_ALL_ACCESS, 0, 0, 0));
+    CloseHandle(hMapping); // the view keeps the mapping alive
+    if (pMappedFile == nullptr) [[unlikely]] {
+        return std::format(
+            "failed to map the include cache file \"{}\", error: {}", pathToFile.string(), GetLastError());
+    }
+#else
+    const int iFileDescriptor = ::open(pathToFile.c_str(), O_RDWR | O_CLOEXEC); // NOLINT
+    if (iFileDescriptor < 0) [[unlikely]] {
+        return std::format(
+            "failed to open the include cache file \"{}\", error: {}", pathToFile.string(), errno);
+    }
+    void* pMapped = mmap(nullptr, iActualFileSize, PROT_READ | PROT_WRITE, MAP_SHARED, iFileDescriptor, 0);
+    close(iFileDescriptor); // the mapping keeps the file open
+    if (pMapped == MAP_FAILED) [[unlikely]] { // NOLINT
+        return std::format(
+            "failed to map the include cache file \"{}\", error: {}", pathToFile.string(), errno);
+    }
+    pMappedFile = static_cast<std::byte*>(pMapped);
+#endif
+
+    auto pCache = std::unique_ptr<SharedIncludeCache>(
+        new SharedIncludeCache(pMappedFile, static_cast<size_t>(iActualFileSize)));
+
+    // Mark the file as initialized (a file of zeros is a valid empty cache so no other setup is needed).
+    auto* pHeader = reinterpret_cast<FileHeader*>(pMappedFile); // NOLINT
+    uint64_t iExpectedFormatId = 0;
+    std::atomic_ref<uint64_t>(pHeader->iFileFormatId)
+        .compare_exchange_strong(iExpectedFormatId, iFileFormatId);
+    if (iExpectedFormatId != 0 && iExpectedFormatId != iFileFormatId) [[unlikely]] {
+        return std::format(
+            "the include cache file \"{}\" was created by an incompatible version of the parser, remove "
+            "the file to reset the cache",
+            pathToFile.string());
+    }
+
+    return pCache;
+}
+
+SharedIncludeCache::SharedIncludeCache(std::byte* pMappedFile, size_t iFileSize)
+    : pMappedFile(pMappedFile), iFileSize(iFileSize) {}
+
+SharedIncludeCache::~SharedIncludeCache() {
+#if defined(_WIN32)
+    UnmapViewOfFile(pMappedFile);
+#else
+    munmap(pMappedFile, iFileSize);
+#endif
+}
+
+uint64_t SharedIncludeCache::computeHash(std::string_view sBytes, uint64_t iSeed) {
+    uint64_t iHash = iSeed;
+    for (const char character : sBytes) {
+        iHash ^= static_cast<unsigned char>(character);
+        iHash *= iHashPrime;
+    }
+    return iHash;
+}
+
+uint64_t& SharedIncludeCache::getSlot(size_t iSlotIndex) const {
+    return *reinterpret_cast<uint64_t*>( // NOLINT
+        pMappedFile + iSlotTableOffset + (iSlotIndex % iSlotCount) * sizeof(uint64_t));
+}
+
+std::optional<std::string_view> SharedIncludeCache::readEntryIfKeyMatches(
+    uint64_t iEntryOffset, uint64_t iKeyHash, std::string_view sKey) const {
+    // Make sure the entry is inside of the file (in case the file was damaged).
+    if (iEntryOffset < iEntriesOffset || iEntryOffset % iEntryAlignment != 0 ||
+        iEntryOffset + sizeof(EntryHeader) > iFileSize) [[unlikely]] {
+        return {};
+    }
+    const auto* pEntry = reinterpret_cast<const EntryHeader*>(pMappedFile + iEntryOffset); // NOLINT
+    const auto iDataOffset = iEntryOffset + sizeof(EntryHeader);
+    if (iDataOffset + pEntry->iKeySize + pEntry->iValueSize > iFileSize) [[unlikely]] {
+        return {};
+    }
+
+    // Compare keys.
+    const auto* pData = reinterpret_cast<const char*>(pMappedFile + iDataOffset); // NOLINT
+    if (pEntry->iKeyHash != iKeyHash || std::string_view(pData, pEntry->iKeySize) != sKey) {
+        return {};
+    }
+
+    return std::string_view(pData + pEntry->iKeySize, pEntry->iValueSize); // NOLINT
+}
+
+std::optional<std::string_view> SharedIncludeCache::find(std::string_view sKey) const {
+    const auto iKeyHash = computeHash(sKey);
+
+    for (size_t i = 0; i < iMaxProbeCount; i++) {
+        // Acquire to see the entry written before the slot was published.
+        const auto iEntryOffset =
+            std::atomic_ref<uint64_t>(getSlot(iKeyHash + i)).load(std::memory_order_acquire);
+        if (iEntryOffset == 0) {
+            return {};
+        }
+
+        auto optionalValue = readEntryIfKeyMatches(iEntryOffset, iKeyHash, sKey);
+        if (optionalValue.has_value()) {
+            return optionalValue;
+        }
+    }
+
+    return {};
+}
+
+bool SharedIncludeCache::insert(std::string_view sKey, std::string_view sValue) {
+    if (find(sKey).has_value()) {
+        return true;
+    }
+    if (sKey.size() > std::numeric_limits<uint32_t>::max() ||
+        sValue.size() > std::numeric_limits<uint32_t>::max()) [[unlikely]] {
+        return false;
+    }
+
+    // Allocate space for the entry.
+    const auto iEntrySize =
+        (sizeof(EntryHeader) + sKey.size() + sValue.size() + iEntryAlignment - 1) / iEntryAlignment *
+        iEntryAlignment;
+    auto* pHeader = reinterpret_cast<FileHeader*>(pMappedFile); // NOLINT
+    const auto iEntryOffset =
+        iEntriesOffset + std::atomic_ref<uint64_t>(pHeader->iUsedEntriesSize).fetch_add(iEntrySize);
+    if (iEntryOffset + iEntrySize > iFileSize) {
+        // Full, the counter stays past the end so next insertions fail quickly.
+        return false;
+    }
+
+    // Write the entry (not visible to other processes until published).
+    const auto iKeyHash = computeHash(sKey);
+    EntryHeader entry{};
+    entry.iKeyHash = iKeyHash;
+    entry.iKeySize = static_cast<uint32_t>(sKey.size());
+    entry.iValueSize = static_cast<uint32_t>(sValue.size());
+    auto* pEntry = pMappedFile + iEntryOffset; // NOLINT
+    std::memcpy(pEntry, &entry, sizeof(entry));
+    std::memcpy(pEntry + sizeof(entry), sKey.data(), sKey.size());                // NOLINT
+    std::memcpy(pEntry + sizeof(entry) + sKey.size(), sValue.data(), sValue.size()); // NOLINT
+
+    // Publish the entry in the first free slot.
+    for (size_t i = 0; i < iMaxProbeCount; i++) {
+        uint64_t iExpectedOffset = 0;
+        if (std::atomic_ref<uint64_t>(getSlot(iKeyHash + i))
+                .compare_exchange_strong(
+                    iExpectedOffset, iEntryOffset, std::memory_order_release, std::memory_order_acquire)) {
+            return true;
+        }
+
+        // Another process might have published the same entry.
+        if (readEntryIfKeyMatches(iExpectedOffset, iKeyHash, sKey).has_value()) {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+// Standard.
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <optional>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Cache of parsed included files stored in a memory-mapped file so that it's shared between all processes
+ * (for example build workers) that use the same cache directory on the host.
+ *
+ * Entries are only added (never changed or removed): a new entry is written to the free space of the file
+ * and then published by atomically storing its offset in a table of slots, so readers don't take any locks
+ * and never see partially written entries. When the file is full new entries are not added (remove the
+ * file to reset the cache).
+ */
+class SharedIncludeCache {
+public:
+    SharedIncludeCache() = delete;
+    SharedIncludeCache(const SharedIncludeCache&) = delete;
+    SharedIncludeCache& operator=(const SharedIncludeCache&) = delete;
+    SharedIncludeCache(SharedIncludeCache&&) = delete;
+    SharedIncludeCache& operator=(SharedIncludeCache&&) = delete;
+
+    /** Unmaps the cache file. */
+    ~SharedIncludeCache();
+
+    /**
+     * Opens the cache file in the specified directory (the directory and the file are created if they
+     * don't exist).
+     *
+     * @param pathToDirectory Directory to store the cache file in.
+     * @param iFileSize       Size of the cache file (in bytes) if it does not exist yet (the size of an
+     * existing file is used as is).
+     *
+     * @return Error message if something went wrong, otherwise opened cache.
+     */
+    static std::variant<std::unique_ptr<SharedIncludeCache>, std::string>
+    open(const std::filesystem::path& pathToDirectory, size_t iFileSize);
+
+    /**
+     * Computes 64 bit FNV-1a hash of the specified bytes. Unlike `std::hash` the result is the same in
+     * all processes and builds so it can be stored in the cache.
+     *
+     * @param sBytes Bytes to hash.
+     * @param iSeed  Hash to continue (to hash multiple strings as one).
+     *
+     * @return Hash.
+     */
+    static uint64_t computeHash(std::string_view sBytes, uint64_t iSeed = iHashOffsetBasis);
+
+    /**
+     * Looks for an entry with the specified key.
+     *
+     * @param sKey Key of the entry.
+     *
+     * @return Empty if not found, otherwise value of the entry (stays valid while this object exists).
+     */
+    std::optional<std::string_view> find(std::string_view sKey) const;
+
+    /**
+     * Adds a new entry (does nothing if an entry with the same key already exists).
+     *
+     * @param sKey   Key of the entry.
+     * @param sValue Value of the entry.
+     *
+     * @return `false` if the cache is full, otherwise `true`.
+     */
+    bool insert(std::string_view sKey, std::string_view sValue);
+
+    /** Name of the cache file. */
+    static constexpr std::string_view sCacheFileName = "csl_include_cache.bin";
+
+    /** Default size of the cache file (in bytes). */
+    static constexpr size_t iDefaultFileSize = 64 * 1024 * 1024; // NOLINT
+
+private:
+    /** Beginning of the cache file (a file filled with zeros is a valid empty cache). */
+    struct FileHeader {
+        /** Set to @ref iFileFormatId by the first process that opens the file. */
+        uint64_t iFileFormatId;
+
+        /** Size of the used part of the entries region (entries are appended). */
+        uint64_t iUsedEntriesSize;
+    };
+
+    /** Beginning of an entry (followed by key and value bytes). */
+    struct EntryHeader {
+        /** Hash of the key. */
+        uint64_t iKeyHash;
+
+        /** Size of the key in bytes. */
+        uint32_t iKeySize;
+
+        /** Size of the value in bytes. */
+        uint32_t iValueSize;
+    };
+
+    /**
+     * Initializes the object.
+     *
+     * @param pMappedFile Mapped cache file.
+     * @param iFileSize   Size of the mapped file.
+     */
+    SharedIncludeCache(std::byte* pMappedFile, size_t iFileSize);
+
+    /**
+     * Returns the slot at the specified index of the slot table (stores offset of an entry from the
+     * beginning of the file or `0` if the slot is free).
+     *
+     * @param iSlotIndex Index of the slot.
+     *
+     * @return Slot.
+     */
+    uint64_t& getSlot(size_t iSlotIndex) const;
+
+    /**
+     * Tells if a valid entry with the specified key is stored at the specified offset.
+     *
+     * @param iEntryOffset Offset of the entry from the beginning of the file.
+     * @param iKeyHash     Hash of the key.
+     * @param sKey         Key.
+     *
+     * @return Value of the entry if the key matches.
+     */
+    std::optional<std::string_view>
+    readEntryIfKeyMatches(uint64_t iEntryOffset, uint64_t iKeyHash, std::string_view sKey) const;
+
+    /** Mapped cache file. */
+    std::byte* pMappedFile = nullptr;
+
+    /** Size of the mapped file in bytes. */
+    size_t iFileSize = 0;
+
+    /** Offset basis of the FNV-1a hash. */
+    static constexpr uint64_t iHashOffsetBasis = 14695981039346656037ULL;
+
+    /** Prime of the FNV-1a hash. */
+    static constexpr uint64_t iHashPrime = 1099511628211ULL;
+
+    /** Identifies the layout of the cache file ("CSLINC" and layout version). */
+    static constexpr uint64_t iFileFormatId = 0x43534C494E430001ULL;
+
+    /** Number of slots in the slot table (stored after the file header). */
+    static constexpr size_t iSlotCount = 65536; // NOLINT
+
+    /** Maximum number of slots to look at when looking for an entry (linear probing). */
+    static constexpr size_t iMaxProbeCount = 64; // NOLINT
+
+    /** Offset of the slot table from the beginning of the file. */
+    static constexpr size_t iSlotTableOffset = 64; // NOLINT
+
+    /** Offset of the entries region from the beginning of the file. */
+    static constexpr size_t iEntriesOffset = iSlotTableOffset + iSlotCount * sizeof(uint64_t);
+
+    /** Alignment of entries in the file. */
+    static constexpr size_t iEntryAlignment = alignof(uint64_t);
+};
@@ -1,5 +1,8 @@
 // Standard.
 #include <fstream>
+#include <array>
+#include <thread>
+#include <algorithm>
 
 // Custom.
 #include "CombinedShaderLanguageParser.h"
@@ -29,6 +32,20 @@ std::string getDiff(const std::string& sActual, const std::string& sExpected) {
     return sDiff;
 }
 
+std::string readExpectedCode(const std::filesystem::path& pathToFile) {
+    std::ifstream file(pathToFile);
+    REQUIRE(file.is_open());
+
+    // Pushing the file though the parser to have constant line endings and stuff.
+    std::string sExpectedCode;
+    std::string sLineBuffer;
+    while (std::getline(file, sLineBuffer)) {
+        sExpectedCode += sLineBuffer + "\n";
+    }
+
+    return sExpectedCode;
+}
+
 void testCompareParsingResults(
     const std::filesystem::path& pathToDirectory, unsigned int iBaseAutomaticBindingIndex = 0) {
     INFO("checking directory: " + pathToDirectory.filename().string());
@@ -171,6 +188,44 @@ void testCompareParsingResults(
     INFO("[TEST PASSED] directory: " + pathToDirectory.filename().string());
 }
 
+void testCompareParsingResultsWithOptions(
+    const std::filesystem::path& pathToDirectory, const CombinedShaderLanguageParser::ParseOptions& options) {
+    INFO("checking directory: " + pathToDirectory.filename().string());
+
+    // Make sure the source file exists.
+    const auto pathToParse = pathToDirectory / "to_parse.glsl";
+    if (!std::filesystem::exists(pathToParse)) [[unlikely]] {
+        INFO("expected the file \"" + pathToParse.string() + "\" to exist");
+        REQUIRE(false);
+    }
+
+    for (const auto bParseAsHlsl : {true, false}) {
+        // Skip if there is no result for this language.
+        const auto pathToResult = pathToDirectory / (bParseAsHlsl ? "result.hlsl" : "result.glsl");
+        if (!std::filesystem::exists(pathToResult)) {
+            continue;
+        }
+
+        // Parse the source code.
+        auto result = CombinedShaderLanguageParser::parse(pathToParse, bParseAsHlsl, options);
+        if (std::holds_alternative<CombinedShaderLanguageParser::Error>(result)) [[unlikely]] {
+            const auto error = std::get<CombinedShaderLanguageParser::Error>(std::move(result));
+            INFO(std::format("{} | path: {}", error.sErrorMessage, error.pathToErrorFile.string()));
+            REQUIRE(false);
+        }
+        const auto sActual = std::get<CombinedShaderLanguageParser::ParseResult>(result).sFullSourceCode;
+
+        // Compare the resulting code with the expected code.
+        const auto sExpected = readExpectedCode(pathToResult);
+        if (sActual != sExpected) {
+            INFO(
+                std::format("actual {} != expected:\n", bParseAsHlsl ? "HLSL" : "GLSL") +
+                getDiff(sActual, sExpected));
+            REQUIRE(false);
+        }
+    }
+}
+
 void testParsingMustFail(const std::filesystem::path& pathToDirectory) {
     // Make sure the path exists.
     if (!std::filesystem::exists(pathToDirectory)) [[unlikely]] {
@@ -202,6 +257,104 @@ TEST_CASE("parse a sample file with additional push constants") {
 TEST_CASE("parse a sample file with additional root constants") {
     testCompareParsingResults("res/test/additional_root_constants");
 }
+
+TEST_CASE("compute layout of push/root constants") {
+    const std::filesystem::path pathToParse = "res/test/shader_constants_layout/to_parse.glsl";
+
+    using Member = CombinedShaderLanguageParser::ShaderConstantsMember;
+    const auto checkLayout = [&](bool bParseAsHlsl,
+                                 const std::vector<std::pair<unsigned int, unsigned int>>& vExpectedMembers,
+                                 unsigned int iExpectedTotalSize) {
+        CombinedShaderLanguageParser::ParseOptions options{};
+        options.bComputeShaderConstantsLayout = true;
+
+        auto result = CombinedShaderLanguageParser::parse(pathToParse, bParseAsHlsl, options);
+        REQUIRE(std::holds_alternative<CombinedShaderLanguageParser::ParseResult>(result));
+        const auto parseResult = std::get<CombinedShaderLanguageParser::ParseResult>(std::move(result));
+        REQUIRE(parseResult.optionalShaderConstantsLayout.has_value());
+        REQUIRE(parseResult.vWarnings.empty());
+
+        const auto& layout = parseResult.optionalShaderConstantsLayout.value();
+        REQUIRE(layout.vMembers.size() == vExpectedMembers.size());
+        for (size_t i = 0; i < vExpectedMembers.size(); i++) {
+            const Member& member = layout.vMembers[i];
+            INFO(member.sName);
+            REQUIRE(member.iOffset == vExpectedMembers[i].first);
+            REQUIRE(member.iSize == vExpectedMembers[i].second);
+        }
+        REQUIRE(layout.vMembers[4].sName == "weights");
+        REQUIRE(layout.vMembers[4].iArraySize == 2);
+        REQUIRE(layout.iTotalSize == iExpectedTotalSize);
+    };
+
+    // std430: `vec3` is aligned to 16 bytes.
+    checkLayout(false, {{0, 4}, {16, 12}, {28, 4}, {32, 64}, {96, 8}}, 104);
+
+    // cbuffer packing: `float3` fits right after `uint`, arrays start at a new register.
+    checkLayout(true, {{0, 4}, {4, 12}, {16, 4}, {32, 64}, {96, 20}}, 116); // NOLINT
+
+    // Check budget.
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.bComputeShaderConstantsLayout = true;
+    options.iShaderConstantsSizeBudget = 64; // NOLINT
+
+    auto result = CombinedShaderLanguageParser::parse(pathToParse, false, options);
+    REQUIRE(std::holds_alternative<CombinedShaderLanguageParser::ParseResult>(result));
+    REQUIRE(std::get<CombinedShaderLanguageParser::ParseResult>(result).vWarnings.size() == 1);
+
+    options.bFailIfShaderConstantsExceedBudget = true;
+    result = CombinedShaderLanguageParser::parse(pathToParse, false, options);
+    REQUIRE(std::holds_alternative<CombinedShaderLanguageParser::Error>(result));
+}
+
+TEST_CASE("compute layout of 16 bit push/root constants") {
+    const std::filesystem::path pathToParse = "res/test/shader_constants_layout_16bit/to_parse.glsl";
+
+    const auto checkLayout = [&](bool bParseAsHlsl,
+                                 const std::vector<std::pair<unsigned int, unsigned int>>& vExpectedMembers,
+                                 unsigned int iExpectedTotalSize) {
+        CombinedShaderLanguageParser::ParseOptions options{};
+        options.bComputeShaderConstantsLayout = true;
+
+        auto result = CombinedShaderLanguageParser::parse(pathToParse, bParseAsHlsl, options);
+        REQUIRE(std::holds_alternative<CombinedShaderLanguageParser::ParseResult>(result));
+        const auto& optionalLayout =
+            std::get<CombinedShaderLanguageParser::ParseResult>(result).optionalShaderConstantsLayout;
+        REQUIRE(optionalLayout.has_value());
+        REQUIRE(optionalLayout->vMembers.size() == vExpectedMembers.size());
+        for (size_t i = 0; i < vExpectedMembers.size(); i++) {
+            INFO(optionalLayout->vMembers[i].sName);
+            REQUIRE(optionalLayout->vMembers[i].iOffset == vExpectedMembers[i].first);
+            REQUIRE(optionalLayout->vMembers[i].iSize == vExpectedMembers[i].second);
+        }
+        REQUIRE(optionalLayout->iTotalSize == iExpectedTotalSize);
+    };
+
+    // std430: `f16vec3` and `f16vec4` are aligned to 8 bytes, columns of `f16mat2` to 4 bytes.
+    checkLayout(false, {{0, 2}, {8, 6}, {14, 2}, {16, 8}, {24, 8}}, 32); // NOLINT
+
+    // cbuffer packing: `half4` does not cross a register, matrices start at a new register.
+    checkLayout(true, {{0, 2}, {2, 6}, {8, 2}, {16, 8}, {32, 20}}, 52); // NOLINT
+}
+
+TEST_CASE("reorder additional push/root constants to minimize padding") {
+    const std::filesystem::path pathToDirectory = "res/test/reorder_additional_shader_constants";
+
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.bReorderAdditionalShaderConstants = true;
+    testCompareParsingResultsWithOptions(pathToDirectory, options);
+
+    // Without reordering GLSL size is 140 bytes and HLSL size is 112 bytes.
+    for (const auto& [bParseAsHlsl, iExpectedSize] : {std::pair{false, 108U}, std::pair{true, 104U}}) {
+        auto result =
+            CombinedShaderLanguageParser::parse(pathToDirectory / "to_parse.glsl", bParseAsHlsl, options);
+        REQUIRE(std::holds_alternative<CombinedShaderLanguageParser::ParseResult>(result));
+        const auto& optionalLayout =
+            std::get<CombinedShaderLanguageParser::ParseResult>(result).optionalShaderConstantsLayout;
+        REQUIRE(optionalLayout.has_value());
+        REQUIRE(optionalLayout->iTotalSize == iExpectedSize);
+    }
+}
 #endif
 
 TEST_CASE("parse combined file") { testCompareParsingResults("res/test/combined"); }
@@ -222,6 +375,428 @@ TEST_CASE("parse a file with hardcoded binding indices before parser-assigned")
 TEST_CASE("parse a file with mixed indices and non-zero auto binding index") {
     testCompareParsingResults("res/test/non_zero_base_auto_binding_index", 100);
 }
+
+TEST_CASE("assign binding indices in high register spaces") {
+    testCompareParsingResultsWithOptions("res/test/high_register_spaces", {});
+}
+
+TEST_CASE("collect binding reflection while parsing") {
+    const std::filesystem::path pathToDirectory = "res/test/binding_reflection";
+    testCompareParsingResults(pathToDirectory);
+
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.bCollectBindingReflection = true;
+
+    // Check HLSL.
+    auto result = CombinedShaderLanguageParser::parse(pathToDirectory / "to_parse.glsl", true, options);
+    REQUIRE(std::holds_alternative<CombinedShaderLanguageParser::ParseResult>(result));
+    auto vBindings = std::get<CombinedShaderLanguageParser::ParseResult>(std::move(result)).vBindings;
+
+    REQUIRE(vBindings.size() == 3);
+    REQUIRE(vBindings[0].sResourceName == "frameData");
+    REQUIRE(vBindings[0].sDeclaredType == "ConstantBuffer<FrameData>");
+    REQUIRE(vBindings[0].registerType == 'b');
+    REQUIRE(vBindings[0].iBindingIndex == 0);
+    REQUIRE(vBindings[0].bIsAutoAssigned);
+    REQUIRE(vBindings[1].sResourceName == "diffuseTextures");
+    REQUIRE(vBindings[1].sDeclaredType == "Texture2D");
+    REQUIRE(vBindings[1].registerType == 't');
+    REQUIRE(vBindings[1].iSpace == 1);
+    REQUIRE(vBindings[1].iBindingIndex == 2);
+    REQUIRE(!vBindings[1].bIsAutoAssigned);
+    REQUIRE(vBindings[2].sResourceName == "normalTexture");
+    REQUIRE(vBindings[2].iSpace == 0);
+    REQUIRE(vBindings[2].iBindingIndex == 0);
+    REQUIRE(vBindings[2].bIsAutoAssigned);
+
+    // Check GLSL.
+    result = CombinedShaderLanguageParser::parse(pathToDirectory / "to_parse.glsl", false, options);
+    REQUIRE(std::holds_alternative<CombinedShaderLanguageParser::ParseResult>(result));
+    vBindings = std::get<CombinedShaderLanguageParser::ParseResult>(std::move(result)).vBindings;
+
+    REQUIRE(vBindings.size() == 3);
+    REQUIRE(vBindings[0].sResourceName == "FrameData");
+    REQUIRE(vBindings[0].sDeclaredType == "uniform");
+    REQUIRE(vBindings[0].iBindingIndex == 0);
+    REQUIRE(vBindings[0].bIsAutoAssigned);
+    REQUIRE(vBindings[1].sResourceName == "diffuseTextures");
+    REQUIRE(vBindings[1].sDeclaredType == "uniform sampler2D");
+    REQUIRE(vBindings[1].iSpace == 1);
+    REQUIRE(vBindings[1].iBindingIndex == 2);
+    REQUIRE(!vBindings[1].bIsAutoAssigned);
+    REQUIRE(vBindings[2].sResourceName == "normalTexture");
+    REQUIRE(vBindings[2].iBindingIndex == 1);
+    REQUIRE(vBindings[2].bIsAutoAssigned);
+}
+
+TEST_CASE("export descriptor layout") {
+    const std::filesystem::path pathToDirectory = "res/test/descriptor_layout";
+    const auto pathToLayoutFile = std::filesystem::temp_directory_path() / "csl_test_descriptor_layout";
+
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.pathToDescriptorLayoutFile = pathToLayoutFile;
+
+    // Check JSON.
+    for (const auto bParseAsHlsl : {true, false}) {
+        auto result =
+            CombinedShaderLanguageParser::parse(pathToDirectory / "to_parse.glsl", bParseAsHlsl, options);
+        REQUIRE(std::holds_alternative<CombinedShaderLanguageParser::ParseResult>(result));
+        REQUIRE(std::get<CombinedShaderLanguageParser::ParseResult>(result).vBindings.empty());
+
+        const auto pathToExpected =
+            pathToDirectory / (bParseAsHlsl ? "expected_layout_hlsl.json" : "expected_layout_glsl.json");
+        REQUIRE(readExpectedCode(pathToLayoutFile) == readExpectedCode(pathToExpected));
+    }
+
+    // Check binary header.
+    options.descriptorLayoutFormat = CombinedShaderLanguageParser::DescriptorLayoutFormat::BINARY;
+    auto result = CombinedShaderLanguageParser::parse(pathToDirectory / "to_parse.glsl", false, options);
+    REQUIRE(std::holds_alternative<CombinedShaderLanguageParser::ParseResult>(result));
+
+    std::ifstream file(pathToLayoutFile, std::ios::binary);
+    REQUIRE(file.is_open());
+    std::array<char, 12> vHeader{}; // NOLINT: magic, version, set count
+    file.read(vHeader.data(), vHeader.size());
+    REQUIRE(file.good());
+    REQUIRE(std::string_view(vHeader.data(), 4) == "CSLD");
+    REQUIRE(vHeader[4] == 1); // NOLINT: version
+    REQUIRE(vHeader[8] == 2); // NOLINT: set count
+    file.close();
+
+    std::filesystem::remove(pathToLayoutFile);
+}
+
+TEST_CASE("reuse binding indices stored in a binding lock file") {
+    const std::filesystem::path pathToDirectory = "res/test/binding_lock_file";
+    const auto pathToTempDirectory = std::filesystem::temp_directory_path() / "csl_binding_lock_file_test";
+    std::filesystem::remove_all(pathToTempDirectory);
+    std::filesystem::create_directories(pathToTempDirectory);
+    const auto pathToShader = pathToTempDirectory / "shader.glsl";
+
+    for (const auto bParseAsHlsl : {true, false}) {
+        CombinedShaderLanguageParser::ParseOptions options{};
+        options.pathToBindingLockFile = pathToTempDirectory / (bParseAsHlsl ? "hlsl.lock" : "glsl.lock");
+
+        // Parse the first version (creates the lock file).
+        std::filesystem::copy_file(
+            pathToDirectory / "to_parse_v1.glsl",
+            pathToShader,
+            std::filesystem::copy_options::overwrite_existing);
+        auto result = CombinedShaderLanguageParser::parse(pathToShader, bParseAsHlsl, options);
+        REQUIRE(std::holds_alternative<CombinedShaderLanguageParser::ParseResult>(result));
+        REQUIRE(std::filesystem::exists(options.pathToBindingLockFile));
+
+        // Parse the second version: a resource was added to the top and one was removed.
+        std::filesystem::copy_file(
+            pathToDirectory / "to_parse_v2.glsl",
+            pathToShader,
+            std::filesystem::copy_options::overwrite_existing);
+        result = CombinedShaderLanguageParser::parse(pathToShader, bParseAsHlsl, options);
+        if (std::holds_alternative<CombinedShaderLanguageParser::Error>(result)) [[unlikely]] {
+            const auto error = std::get<CombinedShaderLanguageParser::Error>(std::move(result));
+            INFO(std::format("{} | path: {}", error.sErrorMessage, error.pathToErrorFile.string()));
+            REQUIRE(false);
+        }
+        const auto sActual = std::get<CombinedShaderLanguageParser::ParseResult>(result).sFullSourceCode;
+
+        const auto sExpected =
+            readExpectedCode(pathToDirectory / (bParseAsHlsl ? "result_v2.hlsl" : "result_v2.glsl"));
+        if (sActual != sExpected) {
+            INFO("actual != expected:\n" + getDiff(sActual, sExpected));
+            REQUIRE(false);
+        }
+    }
+
+    std::filesystem::remove_all(pathToTempDirectory);
+}
+
+TEST_CASE("keep entries of all shaders when the binding lock file is updated concurrently") {
+    const auto pathToTempDirectory =
+        std::filesystem::temp_directory_path() / "csl_concurrent_binding_lock_file_test";
+    std::filesystem::remove_all(pathToTempDirectory);
+    std::filesystem::create_directories(pathToTempDirectory);
+
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.pathToBindingLockFile = pathToTempDirectory / "bindings.lock";
+
+    // Parse different shaders at the same time.
+    constexpr size_t iShaderCount = 8;
+    std::array<bool, iShaderCount> vIsParsed{};
+    std::vector<std::thread> vThreads;
+    for (size_t i = 0; i < iShaderCount; i++) {
+        const auto pathToShader = pathToTempDirectory / std::format("shader{}.glsl", i);
+        std::filesystem::copy_file("res/test/binding_lock_file/to_parse_v1.glsl", pathToShader);
+        vThreads.emplace_back([&, i, pathToShader]() {
+            vIsParsed[i] = std::holds_alternative<CombinedShaderLanguageParser::ParseResult>(
+                CombinedShaderLanguageParser::parse(pathToShader, true, options));
+        });
+    }
+    for (auto& thread : vThreads) {
+        thread.join();
+    }
+    REQUIRE(std::ranges::all_of(vIsParsed, [](bool bIsParsed) { return bIsParsed; }));
+
+    // Shaders are stored relative to the lock file.
+    std::ifstream file(options.pathToBindingLockFile);
+    REQUIRE(file.is_open());
+    std::array<size_t, iShaderCount> vEntryCounts{};
+    std::string sLineBuffer;
+    while (std::getline(file, sLineBuffer)) {
+        const auto sShaderPath = sLineBuffer.substr(0, sLineBuffer.find('\t'));
+        REQUIRE(sShaderPath.starts_with("shader"));
+        vEntryCounts[static_cast<size_t>(sShaderPath[std::string_view("shader").size()] - '0')] += 1;
+    }
+    file.close();
+    for (const auto iEntryCount : vEntryCounts) {
+        REQUIRE(iEntryCount == 3);
+    }
+
+    std::filesystem::remove_all(pathToTempDirectory);
+}
+
+TEST_CASE("assign descriptor sets and register spaces") {
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.vSpaceGroupOrder = {"frame", "object"};
+    testCompareParsingResultsWithOptions("res/test/automatic_spaces", options);
+}
+
+TEST_CASE("fill gaps between hardcoded binding indices per descriptor set") {
+    const std::filesystem::path pathToDirectory = "res/test/compact_binding_indices";
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.bCompactBindingIndices = true;
+    testCompareParsingResultsWithOptions(pathToDirectory, options);
+
+    auto result = CombinedShaderLanguageParser::parse(pathToDirectory / "to_parse.glsl", false, options);
+    REQUIRE(std::holds_alternative<CombinedShaderLanguageParser::ParseResult>(result));
+    const auto& parseResult = std::get<CombinedShaderLanguageParser::ParseResult>(result);
+    REQUIRE(parseResult.optionalMaxBindingIndex == 2);
+    REQUIRE(parseResult.vBindings.empty());
+}
+
+TEST_CASE("use hardcoded binding indices of included files stored in the include cache") {
+    const auto pathToCacheDirectory = std::filesystem::temp_directory_path() / "csl_test_include_cache";
+    std::filesystem::remove_all(pathToCacheDirectory);
+
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.bCompactBindingIndices = true;
+    options.pathToIncludeCacheDirectory = pathToCacheDirectory;
+
+    // The first parsing fills the cache and the second one takes included files from the cache.
+    testCompareParsingResultsWithOptions("res/test/compact_binding_indices", options);
+    testCompareParsingResultsWithOptions("res/test/compact_binding_indices", options);
+
+    std::filesystem::remove_all(pathToCacheDirectory);
+}
+#endif
+
+TEST_CASE("include cache does not change code that depends on the includer") {
+    const auto pathToCacheDirectory = std::filesystem::temp_directory_path() / "csl_test_include_context";
+    std::filesystem::remove_all(pathToCacheDirectory);
+
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.pathToIncludeCacheDirectory = pathToCacheDirectory;
+
+    // Both files include the same file but the type of generated variables comes from the includer.
+    testCompareParsingResultsWithOptions("res/test/include_cache_context/c1", options);
+    testCompareParsingResultsWithOptions("res/test/include_cache_context/c2", options);
+
+    std::filesystem::remove_all(pathToCacheDirectory);
+}
+
+TEST_CASE("share entries of the include cache between opened caches") {
+    const auto pathToCacheDirectory = std::filesystem::temp_directory_path() / "csl_test_shared_cache";
+    std::filesystem::remove_all(pathToCacheDirectory);
+
+    {
+        // Open the same file twice (as 2 processes would do).
+        const auto iFileSize = SharedIncludeCache::iDefaultFileSize;
+        auto firstResult = SharedIncludeCache::open(pathToCacheDirectory, iFileSize);
+        auto secondResult = SharedIncludeCache::open(pathToCacheDirectory, iFileSize);
+        REQUIRE(std::holds_alternative<std::unique_ptr<SharedIncludeCache>>(firstResult));
+        REQUIRE(std::holds_alternative<std::unique_ptr<SharedIncludeCache>>(secondResult));
+        const auto& pFirstCache = std::get<std::unique_ptr<SharedIncludeCache>>(firstResult);
+        const auto& pSecondCache = std::get<std::unique_ptr<SharedIncludeCache>>(secondResult);
+
+        REQUIRE(!pSecondCache->find("key").has_value());
+        REQUIRE(pFirstCache->insert("key", "value"));
+        REQUIRE(pSecondCache->find("key") == "value");
+
+        // Existing entries are not replaced.
+        REQUIRE(pSecondCache->insert("key", "other value"));
+        REQUIRE(pFirstCache->find("key") == "value");
+    }
+
+    std::filesystem::remove_all(pathToCacheDirectory);
+}
+
+TEST_CASE("evict least recently used entries of the in-process include cache") {
+    const std::string sValue(100, 'a'); // NOLINT
+    const auto iEntrySize = std::string("key0").size() * 2 + sValue.size() +
+                            std::filesystem::absolute("shaders/include/file0.glsl").native().size();
+    MemoryIncludeCache cache(iEntrySize * 2);
+
+    cache.insert("key0", "shaders/include/file0.glsl", sValue);
+    cache.insert("key1", "shaders/include/file1.glsl", sValue);
+    REQUIRE(cache.find("key0") != nullptr); // `key1` is now the least recently used
+
+    cache.insert("key2", "shaders/another/file2.glsl", sValue);
+    REQUIRE(cache.find("key1") == nullptr);
+    REQUIRE(cache.find("key0") != nullptr);
+    REQUIRE(cache.find("key2") != nullptr);
+
+    auto statistics = cache.getStatistics();
+    REQUIRE(statistics.iEntryCount == 2);
+    REQUIRE(statistics.iSizeInBytes == iEntrySize * 2);
+    REQUIRE(statistics.iHitCount == 3);
+    REQUIRE(statistics.iMissCount == 1);
+    REQUIRE(statistics.iEvictionCount == 1);
+
+    // Purge by path prefix (whole path components only).
+    REQUIRE(cache.purge("shaders/inc") == 0);
+    REQUIRE(cache.purge("shaders/include/") == 1);
+    REQUIRE(cache.find("key0") == nullptr);
+    REQUIRE(cache.getStatistics().iEntryCount == 1);
+
+    // Entries bigger than the budget are not added.
+    cache.insert("key3", "shaders/include/file3.glsl", std::string(iEntrySize * 2, 'a'));
+    REQUIRE(cache.find("key3") == nullptr);
+    REQUIRE(cache.find("key2") != nullptr);
+}
+
+TEST_CASE("in-process include cache does not change code that depends on the includer") {
+    MemoryIncludeCache cache(1024 * 1024); // NOLINT
+
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.pMemoryIncludeCache = &cache;
+
+    // Both files include the same file but the type of generated variables comes from the includer.
+    testCompareParsingResultsWithOptions("res/test/include_cache_context/c1", options);
+    testCompareParsingResultsWithOptions("res/test/include_cache_context/c2", options);
+
+    REQUIRE(cache.getStatistics().iEntryCount == 0);
+}
+
+#if defined(ENABLE_AUTOMATIC_BINDING_INDICES)
+TEST_CASE("use hardcoded binding indices of included files stored in the in-process include cache") {
+    MemoryIncludeCache cache(1024 * 1024); // NOLINT
+
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.bCompactBindingIndices = true;
+    options.pMemoryIncludeCache = &cache;
+
+    // The first parsing fills the cache and the second one takes included files from the cache.
+    testCompareParsingResultsWithOptions("res/test/compact_binding_indices", options);
+    testCompareParsingResultsWithOptions("res/test/compact_binding_indices", options);
+
+    const auto statistics = cache.getStatistics();
+    REQUIRE(statistics.iEntryCount == 1);
+    REQUIRE(statistics.iMissCount == 1);
+    REQUIRE(statistics.iHitCount == 1);
+}
+
+TEST_CASE("take parse results from the remote parse cache") {
+    auto serverResult = RemoteParseCacheServer::start();
+    REQUIRE(std::holds_alternative<std::unique_ptr<RemoteParseCacheServer>>(serverResult));
+    const auto& pServer = std::get<std::unique_ptr<RemoteParseCacheServer>>(serverResult);
+    RemoteParseCache cache("127.0.0.1", pServer->getPort());
+
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.bCompactBindingIndices = true;
+    options.bCollectBindingReflection = true;
+    options.pRemoteParseCache = &cache;
+
+    // The first parsing stores results and the second one takes them from the server.
+    std::vector<CombinedShaderLanguageParser::ParseResult> vResults;
+    for (size_t i = 0; i < 2; i++) {
+        testCompareParsingResultsWithOptions("res/test/compact_binding_indices", options);
+
+        auto result = CombinedShaderLanguageParser::parse(
+            "res/test/compact_binding_indices/to_parse.glsl", false, options);
+        REQUIRE(std::holds_alternative<CombinedShaderLanguageParser::ParseResult>(result));
+        vResults.push_back(std::get<CombinedShaderLanguageParser::ParseResult>(std::move(result)));
+    }
+    REQUIRE(vResults[0].optionalMaxBindingIndex == vResults[1].optionalMaxBindingIndex);
+    REQUIRE(!vResults[1].vBindings.empty());
+    REQUIRE(vResults[0].vBindings.size() == vResults[1].vBindings.size());
+    for (size_t i = 0; i < vResults[0].vBindings.size(); i++) {
+        REQUIRE(vResults[0].vBindings[i].sResourceName == vResults[1].vBindings[i].sResourceName);
+        REQUIRE(vResults[0].vBindings[i].iSpace == vResults[1].vBindings[i].iSpace);
+        REQUIRE(vResults[0].vBindings[i].iBindingIndex == vResults[1].vBindings[i].iBindingIndex);
+    }
+
+    const auto statistics = cache.getStatistics();
+    REQUIRE(statistics.iMissCount == 1);
+    REQUIRE(statistics.iStoreCount == 1);
+    REQUIRE(statistics.iHitCount == 3);
+    REQUIRE(statistics.iErrorCount == 0);
+    REQUIRE(pServer->getValueCount() == 1);
+
+    // Different options produce different results.
+    options.iBaseAutomaticBindingIndex = 1;
+    std::ignore = CombinedShaderLanguageParser::parse(
+        "res/test/compact_binding_indices/to_parse.glsl", false, options);
+    REQUIRE(pServer->getValueCount() == 2);
+}
+
+TEST_CASE("assign binding indices for all stages of a pipeline") {
+    const std::filesystem::path pathToDirectory = "res/test/pipeline_binding_indices";
+    const std::vector<std::filesystem::path> vStages = {
+        pathToDirectory / "vertex.glsl", pathToDirectory / "fragment.glsl"};
+
+    for (const auto bParseAsHlsl : {true, false}) {
+        auto result = CombinedShaderLanguageParser::parsePipeline(vStages, bParseAsHlsl, {});
+        if (std::holds_alternative<CombinedShaderLanguageParser::Error>(result)) [[unlikely]] {
+            const auto error = std::get<CombinedShaderLanguageParser::Error>(std::move(result));
+            INFO(std::format("{} | path: {}", error.sErrorMessage, error.pathToErrorFile.string()));
+            REQUIRE(false);
+        }
+        const auto vResults =
+            std::get<std::vector<CombinedShaderLanguageParser::ParseResult>>(std::move(result));
+        REQUIRE(vResults.size() == 2);
+
+        const std::string sExtension = bParseAsHlsl ? ".hlsl" : ".glsl";
+        const auto sExpectedVertex = readExpectedCode(pathToDirectory / ("vertex_result" + sExtension));
+        const auto sExpectedFragment = readExpectedCode(pathToDirectory / ("fragment_result" + sExtension));
+
+        if (vResults[0].sFullSourceCode != sExpectedVertex) {
+            INFO("actual != expected:\n" + getDiff(vResults[0].sFullSourceCode, sExpectedVertex));
+            REQUIRE(false);
+        }
+        if (vResults[1].sFullSourceCode != sExpectedFragment) {
+            INFO("actual != expected:\n" + getDiff(vResults[1].sFullSourceCode, sExpectedFragment));
+            REQUIRE(false);
+        }
+    }
+}
+
+TEST_CASE("assign locations of shader inputs and outputs for all stages of a pipeline") {
+    const std::filesystem::path pathToDirectory = "res/test/pipeline_locations";
+    const std::vector<std::filesystem::path> vStages = {
+        pathToDirectory / "vertex.glsl", pathToDirectory / "fragment.glsl"};
+
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.vVertexInputOrder = {"position", "normal", "uv"};
+
+    auto result = CombinedShaderLanguageParser::parsePipeline(vStages, false, options);
+    if (std::holds_alternative<CombinedShaderLanguageParser::Error>(result)) [[unlikely]] {
+        const auto error = std::get<CombinedShaderLanguageParser::Error>(std::move(result));
+        INFO(std::format("{} | path: {}", error.sErrorMessage, error.pathToErrorFile.string()));
+        REQUIRE(false);
+    }
+    const auto vResults = std::get<std::vector<CombinedShaderLanguageParser::ParseResult>>(std::move(result));
+    REQUIRE(vResults.size() == 2);
+
+    const auto sExpectedVertex = readExpectedCode(pathToDirectory / "vertex_result.glsl");
+    const auto sExpectedFragment = readExpectedCode(pathToDirectory / "fragment_result.glsl");
+    if (vResults[0].sFullSourceCode != sExpectedVertex) {
+        INFO("actual != expected:\n" + getDiff(vResults[0].sFullSourceCode, sExpectedVertex));
+        REQUIRE(false);
+    }
+    if (vResults[1].sFullSourceCode != sExpectedFragment) {
+        INFO("actual != expected:\n" + getDiff(vResults[1].sFullSourceCode, sExpectedFragment));
+        REQUIRE(false);
+    }
+}
 #endif
 
 TEST_CASE("parse a file with mixed keywords on the same line") {
@@ -242,6 +817,123 @@ TEST_CASE("parse a file with atomic functions") {
     testCompareParsingResults("res/test/glsl_to_hlsl_atomics");
 }
 
+TEST_CASE("convert atomic functions that use the original value") {
+    testCompareParsingResults("res/test/glsl_to_hlsl_atomic_results");
+    testCompareParsingResults("res/test/glsl_to_hlsl_atomic_results_in_includes");
+    testCompareParsingResults("res/test/hlsl_to_glsl_atomics");
+}
+
+TEST_CASE("fail to convert atomic functions in conditionally evaluated operands") {
+    for (const auto sDirectory :
+         {"res/test/atomic_in_short_circuit",
+          "res/test/atomic_in_ternary",
+          "res/test/atomic_in_unbraced_if",
+          "res/test/atomic_in_unbraced_for",
+          "res/test/atomic_in_for_header"}) {
+        INFO(sDirectory);
+        const auto pathToParse = std::filesystem::path(sDirectory) / "to_parse.glsl";
+
+        auto hlslResult = CombinedShaderLanguageParser::parseHlsl(pathToParse);
+        REQUIRE(std::holds_alternative<CombinedShaderLanguageParser::Error>(hlslResult));
+
+        auto glslResult = CombinedShaderLanguageParser::parseGlsl(pathToParse);
+        REQUIRE(std::holds_alternative<std::string>(glslResult));
+    }
+}
+
 TEST_CASE("convert HLSL mul to operator*") { testCompareParsingResults("res/test/mul_to_operator"); }
 
 TEST_CASE("convert HLSL sync functions to GLSL") { testCompareParsingResults("res/test/sync_funcs"); }
+
+TEST_CASE("convert memory barriers") {
+    testCompareParsingResults("res/test/glsl_to_hlsl_barriers");
+    testCompareParsingResults("res/test/hlsl_to_glsl_barriers");
+}
+
+TEST_CASE("convert GLSL subgroup operations to HLSL") {
+    testCompareParsingResults("res/test/glsl_to_hlsl_subgroups");
+}
+
+TEST_CASE("convert HLSL wave operations to GLSL") {
+    testCompareParsingResults("res/test/hlsl_to_glsl_waves");
+}
+
+TEST_CASE("convert packing and bit manipulation functions") {
+    testCompareParsingResults("res/test/glsl_to_hlsl_bit_funcs");
+    testCompareParsingResults("res/test/hlsl_to_glsl_bit_funcs");
+}
+
+TEST_CASE("convert 16 bit float types") {
+    testCompareParsingResults("res/test/glsl_to_hlsl_half_types");
+    testCompareParsingResults("res/test/hlsl_to_glsl_half_types");
+
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.bRelaxedHalfPrecision = true;
+    testCompareParsingResultsWithOptions("res/test/glsl_to_hlsl_min16float_types", options);
+}
+
+TEST_CASE("convert compute workgroup size") {
+    testCompareParsingResults("res/test/glsl_to_hlsl_workgroup_size");
+    testCompareParsingResults("res/test/hlsl_to_glsl_workgroup_size");
+    testCompareParsingResults("res/test/workgroup_size_before_declarations");
+}
+
+TEST_CASE("use workgroup size values from parse options instead of ?") {
+    const std::filesystem::path pathToDirectory = "res/test/workgroup_size_overrides";
+
+    // Not specified values must fail.
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.workgroupSize = {{"local_size_x", 16}};
+    for (const auto bParseAsHlsl : {true, false}) {
+        auto result =
+            CombinedShaderLanguageParser::parse(pathToDirectory / "to_parse.glsl", bParseAsHlsl, options);
+        REQUIRE(std::holds_alternative<CombinedShaderLanguageParser::Error>(result));
+    }
+
+    options.workgroupSize["local_size_y"] = 4;
+    testCompareParsingResultsWithOptions(pathToDirectory, options);
+}
+
+TEST_CASE("convert specialization constants") {
+    testCompareParsingResults("res/test/glsl_to_hlsl_specialization_constants");
+    testCompareParsingResults("res/test/hlsl_to_glsl_specialization_constants");
+}
+
+TEST_CASE("fold specialization constants with specified values") {
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.specializationConstantValues = {{0, "8"}};
+    testCompareParsingResultsWithOptions("res/test/folded_specialization_constants", options);
+}
+
+TEST_CASE("convert loop and branch hints") {
+    testCompareParsingResults("res/test/glsl_to_hlsl_control_flow_attributes");
+    testCompareParsingResults("res/test/hlsl_to_glsl_control_flow_attributes");
+}
+
+TEST_CASE("convert non-square matrices") {
+    testCompareParsingResults("res/test/glsl_to_hlsl_non_square_matrices");
+
+    CombinedShaderLanguageParser::ParseOptions options{};
+    options.matrixLayoutConvention = CombinedShaderLanguageParser::MatrixLayoutConvention::ROW_MAJOR;
+    testCompareParsingResultsWithOptions("res/test/row_major_matrices", options);
+}
+
+TEST_CASE("convert texture loads, gathers and sampling") {
+    testCompareParsingResults("res/test/glsl_to_hlsl_texture_functions");
+    testCompareParsingResults("res/test/hlsl_to_glsl_texture_methods");
+}
+
+TEST_CASE("fail to convert texture sampling that can't be converted") {
+    // Not clear which sampler to use.
+    const std::filesystem::path pathToTwoSamplers =
+        "res/test/texture_sampling_with_two_samplers/to_parse.glsl";
+    REQUIRE(std::holds_alternative<CombinedShaderLanguageParser::Error>(
+        CombinedShaderLanguageParser::parseHlsl(pathToTwoSamplers)));
+    REQUIRE(std::holds_alternative<std::string>(CombinedShaderLanguageParser::parseGlsl(pathToTwoSamplers)));
+
+    // No GLSL equivalent of the minimum LOD argument.
+    const std::filesystem::path pathToUnsupportedArguments =
+        "res/test/texture_sampling_unsupported_arguments/to_parse.glsl";
+    REQUIRE(std::holds_alternative<CombinedShaderLanguageParser::Error>(
+        CombinedShaderLanguageParser::parseGlsl(pathToUnsupportedArguments)));
+}